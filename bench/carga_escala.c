@@ -0,0 +1,68 @@
+// Benchmark de escala da carga dos CSVs (índices hash por ID, inserção no fim em O(1)): carrega N,
+// 2N, 4N e 8N inscrições (com N / 50 eventos e N / 5 participantes) e compara o tempo por inscrição
+// com o da menor carga. Com buscas lineares ou inserções que percorrem a lista o tempo por inscrição
+// cresceria com o tamanho; com os índices e o ponteiro para o fim fica constante
+//   bench/carga_escala [N]        (padrão: 200000)
+
+#define main sistema_main
+#include "../src/main.c"
+#undef main
+#include "comum.h"
+
+#define ESCALA_RODADAS 3        // Menor tempo de 3 cargas de cada tamanho
+#define ESCALA_LIMITE 2.0       // Razão máxima do tempo por inscrição em relação à menor carga; uma
+                                // busca linear ou uma inserção que percorre a lista chegaria a cerca
+                                // de 8x em 8N, e a folga cobre as faltas de cache dos índices grandes
+
+int main(int argc, char* argv[]) {
+    long base = argc > 1 ? atol(argv[1]) : 200000;
+    if (base < 50) {
+        fprintf(stderr, "Uso: %s [N >= 50]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    char diretorio[] = "/tmp/bench_escalaXXXXXX";
+    bench_entrar_diretorio_temporario(diretorio);
+
+    bool linear = true;
+    double referencia = 0.0;
+    printf("inscricoes,eventos,participantes,carga_ms,us_por_inscricao,razao\n");
+    for (int multiplo = 1; multiplo <= 8; multiplo *= 2) {
+        long inscricoes = base * multiplo;
+        int eventos = (int)(inscricoes / 50);
+        int participantes = (int)(inscricoes / 5);
+        bench_gerar_csvs(eventos, participantes, inscricoes);
+
+        double melhor = 0.0;
+        for (int rodada = 0; rodada < ESCALA_RODADAS; rodada++) {
+            TabelaEventos* tabela_eventos;
+            TabelaParticipantes* tabela_participantes;
+            ListaInscricoes* lista_inscricoes;
+            double ms = bench_carregar_csvs(&tabela_eventos, &tabela_participantes, &lista_inscricoes);
+            if (lista_inscricoes->tamanho != inscricoes) {
+                fprintf(stderr, "Carga incompleta: %d de %ld inscrições\n", lista_inscricoes->tamanho, inscricoes);
+                return EXIT_FAILURE;
+            }
+            bench_liberar(tabela_eventos, tabela_participantes, lista_inscricoes);
+            if (rodada == 0 || ms < melhor) {
+                melhor = ms;
+            }
+        }
+
+        double por_inscricao = 1000.0 * melhor / (double)inscricoes;
+        if (multiplo == 1) {
+            referencia = por_inscricao;
+        }
+        double razao = por_inscricao / referencia;
+        if (razao > ESCALA_LIMITE) {
+            linear = false;
+        }
+        printf("%ld,%d,%d,%.0f,%.3f,%.2f\n", inscricoes, eventos, participantes, melhor, por_inscricao, razao);
+        fflush(stdout);
+    }
+    bench_sair_diretorio_temporario(diretorio);
+
+    fprintf(stderr, linear ? "Escala linear: tempo por inscrição até %.1fx o da menor carga\n"
+                           : "Escala não linear: tempo por inscrição passou de %.1fx o da menor carga\n",
+            ESCALA_LIMITE);
+    return linear ? EXIT_SUCCESS : EXIT_FAILURE;
+}
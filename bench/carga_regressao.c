@@ -0,0 +1,68 @@
+// Benchmark de regressão do tempo de carga (inserção no fim em O(1)): carrega 1 milhão de
+// inscrições dos CSVs e faz 1 milhão de inserções pelas funções de cadastro, falhando se alguma
+// das duas passar do limite. Com inserções que percorrem a lista até o fim, cada uma levaria horas
+//   bench/carga_regressao [limite_ms]        (padrão: 5000 ms para cada medição)
+
+#define main sistema_main
+#include "../src/main.c"
+#undef main
+#include "comum.h"
+
+#define REGRESSAO_INSCRICOES 1000000L
+#define REGRESSAO_EVENTOS 20000
+#define REGRESSAO_PARTICIPANTES 200000
+
+int main(int argc, char* argv[]) {
+    double limite = argc > 1 ? atof(argv[1]) : 5000.0;
+    if (limite <= 0) {
+        fprintf(stderr, "Uso: %s [limite_ms > 0]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    char diretorio[] = "/tmp/bench_regressaoXXXXXX";
+    bench_entrar_diretorio_temporario(diretorio);
+    bool dentro = true;
+    printf("medicao,linhas,ms,linhas_por_s,limite_ms\n");
+
+    // 1. Carga dos CSVs (eventos, participantes e inscrições)
+    size_t bytes = bench_gerar_csvs(REGRESSAO_EVENTOS, REGRESSAO_PARTICIPANTES, REGRESSAO_INSCRICOES);
+    TabelaEventos* eventos;
+    TabelaParticipantes* participantes;
+    ListaInscricoes* inscricoes;
+    double ms = bench_carregar_csvs(&eventos, &participantes, &inscricoes);
+    long linhas = REGRESSAO_EVENTOS + REGRESSAO_PARTICIPANTES + REGRESSAO_INSCRICOES;
+    if (inscricoes->tamanho != REGRESSAO_INSCRICOES) {
+        fprintf(stderr, "Carga incompleta: %d de %ld inscrições\n", inscricoes->tamanho, REGRESSAO_INSCRICOES);
+        return EXIT_FAILURE;
+    }
+    printf("carga_csv,%ld,%.0f,%.0f,%.0f\n", linhas, ms, linhas / (ms / 1000.0), limite);
+    dentro = dentro && ms <= limite;
+    bench_liberar(eventos, participantes, inscricoes);
+    fprintf(stderr, "Arquivos gerados: %.1f MB\n", bytes / 1e6);
+    bench_sair_diretorio_temporario(diretorio);
+
+    // 2. Inserções pelas funções de cadastro, na ordem em que o menu e o modo em lote as fazem
+    eventos = tabela_eventos_criar();
+    participantes = tabela_participantes_criar();
+    inscricoes = lista_inscricoes_criar();
+    uint32_t data = data_compactar("2030-01-01");
+    double inicio = relogio_ms();
+    for (int id = 1; id <= REGRESSAO_EVENTOS; id++) {
+        eventos_adicionar(eventos, id, "Evento", "Descrição", bench_categorias[id % BENCH_CATEGORIAS], data,
+                          REGRESSAO_INSCRICOES / REGRESSAO_EVENTOS);
+    }
+    for (int id = 1; id <= REGRESSAO_PARTICIPANTES; id++) {
+        participantes_adicionar(participantes, id, "Participante", "", "");
+    }
+    for (long k = 0; k < REGRESSAO_INSCRICOES; k++) {
+        int participante = (int)(k % REGRESSAO_PARTICIPANTES);
+        int evento = (int)((k / REGRESSAO_PARTICIPANTES + participante) % REGRESSAO_EVENTOS);
+        lista_inscricoes_inscrever(inscricoes, eventos, participantes, participante, evento, "2026-10-16");
+    }
+    ms = relogio_ms() - inicio;
+    printf("insercoes,%ld,%.0f,%.0f,%.0f\n", linhas, ms, linhas / (ms / 1000.0), limite);
+    dentro = dentro && ms <= limite;
+    bench_liberar(eventos, participantes, inscricoes);
+
+    fprintf(stderr, dentro ? "Dentro do limite de %.0f ms\n" : "Regressão: passou do limite de %.0f ms\n", limite);
+    return dentro ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,129 @@
+// Funções compartilhadas pelos benchmarks de bench/: geração determinística dos CSVs de entrada
+// (no mesmo formato gravado por salvar_*_csv), diretório temporário e carga das tabelas.
+// Incluído depois de src/main.c (usa alocar_memoria); as funções POSIX (mkdtemp, chdir) são
+// habilitadas pelo Makefile com _POSIX_C_SOURCE
+
+#include <unistd.h>
+
+#define BENCH_CATEGORIAS 16
+
+static const char* const bench_categorias[BENCH_CATEGORIAS] = {
+    "Tecnologia", "Música", "Teatro", "Esportes", "Gastronomia", "Cinema", "Dança", "Literatura",
+    "Negócios", "Saúde", "Educação", "Fotografia", "Arte", "Ciência", "Games", "Idiomas"
+};
+
+static uint64_t bench_estado = 0x9E3779B97F4A7C15ULL;
+
+// Função para sortear um número (xorshift64*, mesma sequência em toda execução)
+uint32_t bench_sortear(uint32_t limite) {
+    bench_estado ^= bench_estado >> 12;
+    bench_estado ^= bench_estado << 25;
+    bench_estado ^= bench_estado >> 27;
+    return (uint32_t)((bench_estado * 0x2545F4914F6CDD1DULL) >> 32) % limite;
+}
+
+// Função para gerar eventos.csv, participantes.csv e inscricoes.csv no diretório atual. A inscrição k
+// liga o participante k % participantes ao evento (k / participantes + participante) % eventos, então
+// nenhum par se repete; 1 em cada 20 fica cancelada, e as vagas de cada evento batem com as
+// confirmadas. Devolve o total de bytes gravados
+size_t bench_gerar_csvs(int eventos, int participantes, long inscricoes) {
+    if (eventos <= 0 || participantes <= 0 || inscricoes > (long)eventos * participantes) {
+        fprintf(stderr, "Combinação inválida: %d eventos, %d participantes, %ld inscrições\n",
+                eventos, participantes, inscricoes);
+        exit(EXIT_FAILURE);
+    }
+    bench_estado = 0x9E3779B97F4A7C15ULL;
+    size_t bytes = 0;
+
+    // Inscrições primeiro, contando as confirmadas de cada evento
+    int* confirmadas = (int*)alocar_memoria((size_t)eventos * sizeof(int));
+    memset(confirmadas, 0, (size_t)eventos * sizeof(int));
+    FILE* arquivo = fopen("inscricoes.csv", "w");
+    if (arquivo == NULL) {
+        perror("inscricoes.csv");
+        exit(EXIT_FAILURE);
+    }
+    bytes += (size_t)fprintf(arquivo, "idParticipante,idEvento,dataInscricao,status\n");
+    for (long k = 0; k < inscricoes; k++) {
+        int participante = (int)(k % participantes);
+        int evento = (int)((k / participantes + participante) % eventos);
+        int status = k % 20 == 19 ? CANCELADA : CONFIRMADA;
+        if (status == CONFIRMADA) {
+            confirmadas[evento]++;
+        }
+        bytes += (size_t)fprintf(arquivo, "%d,%d,2026-%02d-%02d,%d\n", participante + 1, evento + 1,
+                                 1 + (int)(k % 12), 1 + (int)(k % 28), status);
+    }
+    fclose(arquivo);
+
+    arquivo = fopen("eventos.csv", "w");
+    if (arquivo == NULL) {
+        perror("eventos.csv");
+        exit(EXIT_FAILURE);
+    }
+    bytes += (size_t)fprintf(arquivo, "id,nome,descricao,categoria,data,capacidade,vagasDisponiveis\n");
+    for (int e = 0; e < eventos; e++) {
+        int capacidade = confirmadas[e] + (int)bench_sortear(20);
+        bytes += (size_t)fprintf(arquivo, "%d,\"Evento %d\",\"Encontro número %d, com palestras e oficinas\","
+                                 "\"%s\",%d-%02d-%02d,%d,%d\n",
+                                 e + 1, e + 1, (int)bench_sortear(1000),
+                                 bench_categorias[bench_sortear(BENCH_CATEGORIAS)], 2027 + (int)bench_sortear(4),
+                                 1 + (int)bench_sortear(12), 1 + (int)bench_sortear(28), capacidade,
+                                 capacidade - confirmadas[e]);
+    }
+    fclose(arquivo);
+    liberar_memoria(confirmadas);
+
+    arquivo = fopen("participantes.csv", "w");
+    if (arquivo == NULL) {
+        perror("participantes.csv");
+        exit(EXIT_FAILURE);
+    }
+    bytes += (size_t)fprintf(arquivo, "id,nome,email,telefone\n");
+    for (int p = 0; p < participantes; p++) {
+        bytes += (size_t)fprintf(arquivo, "%d,\"Participante %d\",\"participante%d@exemplo.com\","
+                                 "\"(11) 9%04d-%04d\"\n", p + 1, p + 1, p + 1, (int)bench_sortear(10000),
+                                 p % 10000);
+    }
+    fclose(arquivo);
+    return bytes;
+}
+
+// Função para criar um diretório temporário e passar a trabalhar nele (nome devolvido em diretorio)
+void bench_entrar_diretorio_temporario(char* diretorio) {
+    if (mkdtemp(diretorio) == NULL || chdir(diretorio) != 0) {
+        perror("mkdtemp");
+        exit(EXIT_FAILURE);
+    }
+}
+
+// Função para apagar os arquivos que os benchmarks criam e o diretório temporário
+void bench_sair_diretorio_temporario(const char* diretorio) {
+    static const char* const arquivos[] = { "eventos.csv", "participantes.csv", "inscricoes.csv",
+                                            "dados.bin", "dados.wal" };
+    for (size_t a = 0; a < sizeof(arquivos) / sizeof(arquivos[0]); a++) {
+        remove(arquivos[a]);
+    }
+    if (chdir("/tmp") == 0) {
+        rmdir(diretorio);
+    }
+}
+
+// Função para carregar os três CSVs do diretório atual em tabelas novas, devolvendo o tempo em ms
+double bench_carregar_csvs(TabelaEventos** eventos, TabelaParticipantes** participantes,
+                           ListaInscricoes** inscricoes) {
+    *eventos = tabela_eventos_criar();
+    *participantes = tabela_participantes_criar();
+    *inscricoes = lista_inscricoes_criar();
+    int proximoIdEvento = 1, proximoIdParticipante = 1;
+    double inicio = relogio_ms();
+    carregar_arquivos_csv(*eventos, *participantes, *inscricoes, &proximoIdEvento, &proximoIdParticipante);
+    return relogio_ms() - inicio;
+}
+
+// Função para liberar as tabelas carregadas por bench_carregar_csvs
+void bench_liberar(TabelaEventos* eventos, TabelaParticipantes* participantes, ListaInscricoes* inscricoes) {
+    lista_inscricoes_destruir(inscricoes);
+    tabela_participantes_destruir(participantes);
+    tabela_eventos_destruir(eventos);
+}
@@ -0,0 +1,146 @@
+// Benchmark de vazão da leitura de CSV (leitor com buffer grande e campos no próprio buffer): mede
+// em MB/s, sobre os mesmos três arquivos,
+//   - a leitura de referência: réplica do carregador anterior (fgets em buffers de 1024/512/256
+//     bytes e sscanf por linha), só a conversão, sem montar as listas;
+//   - o leitor atual com as mesmas conversões e validações da carga (csv_campo_*), sem as tabelas;
+//   - a carga completa (carregar_arquivos_csv), que também monta tabelas, índices e listas.
+// Sai com erro se o leitor atual não chegar a CSV_META_LEITOR MB/s ou ao dobro da referência
+//   bench/csv_vazao [inscricoes]        (padrão: 2000000, com 1/50 de eventos e 1/5 de participantes)
+
+#define main sistema_main
+#include "../src/main.c"
+#undef main
+#include "comum.h"
+
+#define CSV_RODADAS 3              // Menor tempo de 3 leituras de cada tipo
+#define CSV_META_LEITOR 150.0      // MB/s mínimos do leitor atual
+
+static const char* const csv_arquivos[3] = { "eventos.csv", "participantes.csv", "inscricoes.csv" };
+
+// Leitura de referência (mesmos formatos de sscanf do carregador anterior); devolve uma soma dos
+// campos numéricos, conferida contra a do leitor atual
+static long long ler_referencia(void) {
+    long long soma = 0;
+    char linha[1024];
+    FILE* f = fopen("eventos.csv", "r");
+    int id, capacidade, vagas;
+    char nome[100], descricao[500], categoria[50], data[11];
+    fgets(linha, sizeof(linha), f); // header
+    while (fgets(linha, sizeof(linha), f)) {
+        if (sscanf(linha, "%d,\"%99[^\"]\",\"%499[^\"]\",\"%49[^\"]\",%10[^,],%d,%d",
+                   &id, nome, descricao, categoria, data, &capacidade, &vagas) == 7) {
+            soma += id + capacidade + vagas;
+        }
+    }
+    fclose(f);
+
+    f = fopen("participantes.csv", "r");
+    char email[100], telefone[20];
+    fgets(linha, 512, f); // header
+    while (fgets(linha, 512, f)) {
+        if (sscanf(linha, "%d,\"%99[^\"]\",\"%99[^\"]\",\"%19[^\"]\"", &id, nome, email, telefone) == 4) {
+            soma += id;
+        }
+    }
+    fclose(f);
+
+    f = fopen("inscricoes.csv", "r");
+    int idParticipante, idEvento, status;
+    char dataInscricao[11];
+    fgets(linha, 256, f); // header
+    while (fgets(linha, 256, f)) {
+        if (sscanf(linha, "%d,%d,%10[^,],%d", &idParticipante, &idEvento, dataInscricao, &status) == 4) {
+            soma += idParticipante + idEvento + status;
+        }
+    }
+    fclose(f);
+    return soma;
+}
+
+// Leitura com o leitor atual e as conversões de carga_converter_bloco, sem montar as tabelas
+static long long ler_atual(void) {
+    long long soma = 0;
+    for (int a = 0; a < 3; a++) {
+        LeitorCSV leitor;
+        if (!csv_abrir(&leitor, csv_arquivos[a])) {
+            exit(EXIT_FAILURE);
+        }
+        csv_proximo_registro(&leitor); // header
+        int resultado;
+        while ((resultado = csv_proximo_registro(&leitor)) != 0) {
+            int id, capacidade, vagas, idEvento, status;
+            uint32_t data;
+            if (resultado < 0) {
+                continue;
+            }
+            if (a == 0) {
+                if (csv_verificar_campos(&leitor, 7) && csv_campo_inteiro(&leitor, 0, &id) &&
+                    csv_campo_data(&leitor, 4, &data) && csv_campo_inteiro(&leitor, 5, &capacidade) &&
+                    csv_campo_inteiro(&leitor, 6, &vagas)) {
+                    soma += id + capacidade + vagas;
+                }
+            } else if (a == 1) {
+                if (csv_verificar_campos(&leitor, 4) && csv_campo_inteiro(&leitor, 0, &id) &&
+                    csv_campo_texto(&leitor, 1, PARTICIPANTE_NOME_TAMANHO) &&
+                    csv_campo_texto(&leitor, 2, PARTICIPANTE_EMAIL_TAMANHO) &&
+                    csv_campo_texto(&leitor, 3, PARTICIPANTE_TELEFONE_TAMANHO)) {
+                    soma += id;
+                }
+            } else {
+                if (csv_verificar_campos(&leitor, 4) && csv_campo_inteiro(&leitor, 0, &id) &&
+                    csv_campo_inteiro(&leitor, 1, &idEvento) && csv_campo_data(&leitor, 2, &data) &&
+                    csv_campo_inteiro(&leitor, 3, &status)) {
+                    soma += id + idEvento + status;
+                }
+            }
+        }
+        csv_fechar(&leitor);
+    }
+    return soma;
+}
+
+int main(int argc, char* argv[]) {
+    long inscricoes = argc > 1 ? atol(argv[1]) : 2000000;
+    if (inscricoes < 50) {
+        fprintf(stderr, "Uso: %s [inscricoes >= 50]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    char diretorio[] = "/tmp/bench_csvXXXXXX";
+    bench_entrar_diretorio_temporario(diretorio);
+    double mb = bench_gerar_csvs((int)(inscricoes / 50), (int)(inscricoes / 5), inscricoes) / 1e6;
+
+    double referencia = 0.0, leitor = 0.0, carga = 0.0;
+    long long soma_referencia = 0, soma_atual = 0;
+    for (int rodada = 0; rodada < CSV_RODADAS; rodada++) {
+        double inicio = relogio_ms();
+        soma_referencia = ler_referencia();
+        double ms = relogio_ms() - inicio;
+        referencia = rodada == 0 || ms < referencia ? ms : referencia;
+
+        inicio = relogio_ms();
+        soma_atual = ler_atual();
+        ms = relogio_ms() - inicio;
+        leitor = rodada == 0 || ms < leitor ? ms : leitor;
+
+        TabelaEventos* eventos;
+        TabelaParticipantes* participantes;
+        ListaInscricoes* lista_inscricoes;
+        ms = bench_carregar_csvs(&eventos, &participantes, &lista_inscricoes);
+        bench_liberar(eventos, participantes, lista_inscricoes);
+        carga = rodada == 0 || ms < carga ? ms : carga;
+    }
+    bench_sair_diretorio_temporario(diretorio);
+
+    double vazao_referencia = mb / (referencia / 1000.0);
+    double vazao_leitor = mb / (leitor / 1000.0);
+    printf("leitura,mb,ms,mb_por_s\n");
+    printf("referencia_fgets_sscanf,%.1f,%.0f,%.1f\n", mb, referencia, vazao_referencia);
+    printf("leitor_atual,%.1f,%.0f,%.1f\n", mb, leitor, vazao_leitor);
+    printf("carga_completa,%.1f,%.0f,%.1f\n", mb, carga, mb / (carga / 1000.0));
+
+    bool iguais = soma_referencia == soma_atual;
+    bool meta = vazao_leitor >= CSV_META_LEITOR && vazao_leitor >= 2.0 * vazao_referencia;
+    fprintf(stderr, "Leitor atual %.1fx a referência (meta: %.0f MB/s e 2x)%s\n", vazao_leitor / vazao_referencia,
+            CSV_META_LEITOR, iguais ? "" : " (ATENÇÃO: leituras diferentes)");
+    return iguais && meta ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,22 @@
+// Gerador dos CSVs usados nos benchmarks, para reproduzir uma medição fora deles:
+//   bench/gerar_dados EVENTOS PARTICIPANTES INSCRICOES
+// grava eventos.csv, participantes.csv e inscricoes.csv no diretório atual (sempre os mesmos dados)
+
+#define main sistema_main
+#include "../src/main.c"
+#undef main
+#include "comum.h"
+
+int main(int argc, char* argv[]) {
+    if (argc != 4) {
+        fprintf(stderr, "Uso: %s EVENTOS PARTICIPANTES INSCRICOES\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    int eventos = atoi(argv[1]);
+    int participantes = atoi(argv[2]);
+    long inscricoes = atol(argv[3]);
+    size_t bytes = bench_gerar_csvs(eventos, participantes, inscricoes);
+    printf("%d eventos, %d participantes e %ld inscrições: %.1f MB\n", eventos, participantes, inscricoes,
+           bytes / 1e6);
+    return EXIT_SUCCESS;
+}
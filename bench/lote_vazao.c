@@ -0,0 +1,116 @@
+// Benchmark de vazão do modo em lote: gera um arquivo com 1.001.000 comandos (1 mil eventos, 200 mil
+// participantes, 700 mil inscrições e 100 mil cancelamentos), processa-o com processar_lote em tabelas
+// vazias, com o log de operações e a saída de resultados em arquivos, e mede os comandos por segundo
+// (menor tempo de 3 execuções). Sai com erro se a vazão ficar abaixo da meta
+//   bench/lote_vazao [sempre|grupo|nunca] [meta_ops]        (padrão: grupo e 1000000 comandos/s)
+
+#define main sistema_main
+#include "../src/main.c"
+#undef main
+#include "comum.h"
+
+#define LOTE_RODADAS 3
+#define LOTE_EVENTOS 1000
+#define LOTE_PARTICIPANTES 200000
+#define LOTE_INSCRICOES 700000
+#define LOTE_CANCELAMENTOS 100000
+
+// Função para gravar o arquivo de comandos; a inscrição k liga o participante k % participantes ao evento
+// (k / participantes + participante) % eventos (sem pares repetidos), e cada sétima é cancelada depois
+static long gerar_comandos(const char* caminho) {
+    FILE* arquivo = fopen(caminho, "w");
+    if (arquivo == NULL) {
+        perror(caminho);
+        exit(EXIT_FAILURE);
+    }
+    long comandos = 0;
+    for (int e = 0; e < LOTE_EVENTOS; e++, comandos++) {
+        fprintf(arquivo, "evento,\"Evento %d\",\"Encontro com palestras e oficinas\",%s,%d-%02d-%02d,%d\n", e + 1,
+                bench_categorias[bench_sortear(BENCH_CATEGORIAS)], 2027 + (int)bench_sortear(4),
+                1 + (int)bench_sortear(12), 1 + (int)bench_sortear(28), LOTE_INSCRICOES / LOTE_EVENTOS + 100);
+    }
+    for (int p = 0; p < LOTE_PARTICIPANTES; p++, comandos++) {
+        fprintf(arquivo, "participante,\"Participante %d\",participante%d@exemplo.com,(11) 9%04d-%04d\n", p + 1,
+                p + 1, (int)bench_sortear(10000), p % 10000);
+    }
+    for (long k = 0; k < LOTE_INSCRICOES; k++, comandos++) {
+        int participante = (int)(k % LOTE_PARTICIPANTES);
+        int evento = (int)((k / LOTE_PARTICIPANTES + participante) % LOTE_EVENTOS);
+        fprintf(arquivo, "inscrever,%d,%d\n", participante + 1, evento + 1);
+    }
+    for (long k = 0; k < LOTE_CANCELAMENTOS; k++, comandos++) {
+        long inscricao = k * (LOTE_INSCRICOES / LOTE_CANCELAMENTOS);
+        int participante = (int)(inscricao % LOTE_PARTICIPANTES);
+        int evento = (int)((inscricao / LOTE_PARTICIPANTES + participante) % LOTE_EVENTOS);
+        fprintf(arquivo, "cancelar,%d,%d\n", participante + 1, evento + 1);
+    }
+    fclose(arquivo);
+    return comandos;
+}
+
+// Função para contar as linhas "ok" do arquivo de resultados
+static long contar_aplicados(const char* caminho) {
+    FILE* arquivo = fopen(caminho, "r");
+    char linha[256];
+    long aplicados = 0;
+    while (arquivo != NULL && fgets(linha, sizeof(linha), arquivo) != NULL) {
+        aplicados += strstr(linha, ",ok,") != NULL;
+    }
+    if (arquivo != NULL) {
+        fclose(arquivo);
+    }
+    return aplicados;
+}
+
+int main(int argc, char* argv[]) {
+    PoliticaSincronizacao politica = LOG_SINCRONIZAR_EM_GRUPO;
+    double meta = argc > 2 ? atof(argv[2]) : 1000000.0;
+    if ((argc > 1 && !politica_de_texto(argv[1], &politica)) || meta <= 0) {
+        fprintf(stderr, "Uso: %s [sempre|grupo|nunca] [meta_ops > 0]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    char diretorio[] = "/tmp/bench_loteXXXXXX";
+    bench_entrar_diretorio_temporario(diretorio);
+    long comandos = gerar_comandos("comandos.csv");
+
+    // A saída padrão vai para o arquivo de resultados, como em --lote=comandos.csv > resultado.csv
+    int saida_original = dup(fileno(stdout));
+    double melhor = 0.0;
+    long aplicados = 0;
+    for (int rodada = 0; rodada < LOTE_RODADAS; rodada++) {
+        TabelaEventos* eventos = tabela_eventos_criar();
+        TabelaParticipantes* participantes = tabela_participantes_criar();
+        ListaInscricoes* inscricoes = lista_inscricoes_criar();
+        int proximoIdEvento = 1, proximoIdParticipante = 1;
+        remove(ARQUIVO_LOG);
+        LogOperacoes log;
+        log_abrir(&log, ARQUIVO_LOG, politica);
+
+        fflush(stdout);
+        if (freopen("resultado.csv", "w", stdout) == NULL) {
+            perror("resultado.csv");
+            return EXIT_FAILURE;
+        }
+        double inicio = relogio_ms();
+        processar_lote("comandos.csv", eventos, participantes, inscricoes, &log, &proximoIdEvento,
+                       &proximoIdParticipante);
+        double ms = relogio_ms() - inicio;
+        fflush(stdout);
+        dup2(saida_original, fileno(stdout));
+
+        melhor = rodada == 0 || ms < melhor ? ms : melhor;
+        aplicados = contar_aplicados("resultado.csv");
+        log_fechar(&log);
+        bench_liberar(eventos, participantes, inscricoes);
+    }
+    close(saida_original);
+    remove("comandos.csv");
+    remove("resultado.csv");
+    bench_sair_diretorio_temporario(diretorio);
+
+    double vazao = comandos / (melhor / 1000.0);
+    printf("sincronizacao,comandos,aplicados,ms,comandos_por_s\n");
+    printf("%s,%ld,%ld,%.0f,%.0f\n", argc > 1 ? argv[1] : "grupo", comandos, aplicados, melhor, vazao);
+    fprintf(stderr, "Meta de %.0f comandos/s %s\n", meta, vazao >= meta ? "atingida" : "NÃO atingida");
+    return aplicados == comandos && vazao >= meta ? EXIT_SUCCESS : EXIT_FAILURE;
+}
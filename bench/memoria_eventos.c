@@ -0,0 +1,146 @@
+// Benchmark de memória dos eventos (textos no heap, categorias internadas): cadastra 1 milhão de
+// eventos em um processo filho para cada estrutura e mede o aumento da memória residente
+//   - lista_de_nos: réplica dos nós Evento anteriores (textos fixos de 650 bytes, um malloc por nó)
+//   - tabela: a tabela de eventos atual, com os índices por ID, data, categoria e trigramas
+// Mostra também os bytes contabilizados (tabela_eventos_bytes), os bytes só dos textos e o total sem o
+// índice de trigramas da busca textual, que não existia antes. Só para Linux (lê /proc/self/statm)
+//   bench/memoria_eventos [eventos]        (padrão: 1000000)
+
+#define main sistema_main
+#include "../src/main.c"
+#undef main
+#include "comum.h"
+#include <sys/wait.h>
+
+// Réplica do nó de evento anterior ao heap de textos
+typedef struct evento_antigo {
+    int id;
+    char nome[100];
+    char descricao[500];
+    char categoria[50];
+    char data[11];
+    int capacidade;
+    int vagasDisponiveis;
+    struct evento_antigo* proximo;
+} EventoAntigo;
+
+// Função para ler a memória residente atual do processo, em bytes
+static size_t memoria_residente(void) {
+    FILE* arquivo = fopen("/proc/self/statm", "r");
+    unsigned long paginas = 0, residentes = 0;
+    if (arquivo == NULL || fscanf(arquivo, "%lu %lu", &paginas, &residentes) != 2) {
+        fprintf(stderr, "Não foi possível ler /proc/self/statm\n");
+        exit(EXIT_FAILURE);
+    }
+    fclose(arquivo);
+    return (size_t)residentes * (size_t)sysconf(_SC_PAGESIZE);
+}
+
+// Textos de um evento (os mesmos nas duas estruturas)
+static void texto_evento(int k, char* nome, size_t tamanho_nome, char* descricao, size_t tamanho_descricao,
+                         const char** categoria, uint32_t* data) {
+    snprintf(nome, tamanho_nome, "Evento %d", k + 1);
+    snprintf(descricao, tamanho_descricao, "Encontro número %d, com palestras e oficinas", (int)bench_sortear(1000));
+    *categoria = bench_categorias[bench_sortear(BENCH_CATEGORIAS)];
+    *data = (uint32_t)((2027 + (int)bench_sortear(4)) * 10000 + (1 + (int)bench_sortear(12)) * 100 +
+                       1 + (int)bench_sortear(28));
+}
+
+// Cadastro na estrutura anterior: copia os textos para os vetores fixos, como evento_criar
+static void medir_lista_de_nos(int quantidade, int saida) {
+    size_t antes = memoria_residente();
+    EventoAntigo* inicio = NULL;
+    EventoAntigo* fim = NULL;
+    for (int k = 0; k < quantidade; k++) {
+        char nome[100], descricao[500];
+        const char* categoria;
+        uint32_t data;
+        texto_evento(k, nome, sizeof(nome), descricao, sizeof(descricao), &categoria, &data);
+        EventoAntigo* no = (EventoAntigo*)alocar_memoria(sizeof(EventoAntigo));
+        no->id = k + 1;
+        strncpy(no->nome, nome, sizeof(no->nome) - 1);
+        no->nome[sizeof(no->nome) - 1] = '\0';
+        strncpy(no->descricao, descricao, sizeof(no->descricao) - 1);
+        no->descricao[sizeof(no->descricao) - 1] = '\0';
+        strncpy(no->categoria, categoria, sizeof(no->categoria) - 1);
+        no->categoria[sizeof(no->categoria) - 1] = '\0';
+        data_formatar(data, no->data);
+        no->capacidade = 100;
+        no->vagasDisponiveis = 100;
+        no->proximo = NULL;
+        if (fim == NULL) {
+            inicio = no;
+        } else {
+            fim->proximo = no;
+        }
+        fim = no;
+    }
+    size_t textos = sizeof(inicio->nome) + sizeof(inicio->descricao) + sizeof(inicio->categoria);
+    size_t medidas[4] = { memoria_residente() - antes, (size_t)quantidade * sizeof(EventoAntigo),
+                          (size_t)quantidade * textos, 0 };
+    if (write(saida, medidas, sizeof(medidas)) != (ssize_t)sizeof(medidas) || inicio == NULL) {
+        exit(EXIT_FAILURE);
+    }
+}
+
+// Cadastro na tabela atual, pelo mesmo caminho do menu e do modo em lote
+static void medir_tabela(int quantidade, int saida) {
+    size_t antes = memoria_residente();
+    TabelaEventos* tabela = tabela_eventos_criar();
+    for (int k = 0; k < quantidade; k++) {
+        char nome[100], descricao[500];
+        const char* categoria;
+        uint32_t data;
+        texto_evento(k, nome, sizeof(nome), descricao, sizeof(descricao), &categoria, &data);
+        eventos_adicionar(tabela, k + 1, nome, descricao, categoria, data, 100);
+    }
+    size_t medidas[4] = { memoria_residente() - antes, tabela_eventos_bytes(tabela), tabela->textos.capacidade,
+                          indice_trigramas_bytes(&tabela->trigramas) };
+    if (write(saida, medidas, sizeof(medidas)) != (ssize_t)sizeof(medidas)) {
+        exit(EXIT_FAILURE);
+    }
+}
+
+// Função para medir uma estrutura em um processo filho (a memória liberada por uma não mascara a outra)
+static void medir_em_processo(void (*medir)(int, int), int quantidade, size_t medidas[4]) {
+    int canal[2];
+    if (pipe(canal) != 0) {
+        perror("pipe");
+        exit(EXIT_FAILURE);
+    }
+    pid_t filho = fork();
+    if (filho == 0) {
+        close(canal[0]);
+        medir(quantidade, canal[1]);
+        _exit(EXIT_SUCCESS);
+    }
+    close(canal[1]);
+    if (filho < 0 || read(canal[0], medidas, 4 * sizeof(size_t)) != (ssize_t)(4 * sizeof(size_t))) {
+        fprintf(stderr, "Falha na medição\n");
+        exit(EXIT_FAILURE);
+    }
+    close(canal[0]);
+    waitpid(filho, NULL, 0);
+}
+
+int main(int argc, char* argv[]) {
+    int quantidade = argc > 1 ? atoi(argv[1]) : 1000000;
+    if (quantidade <= 0) {
+        fprintf(stderr, "Uso: %s [eventos > 0]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    size_t antiga[4], atual[4];
+    medir_em_processo(medir_lista_de_nos, quantidade, antiga);
+    medir_em_processo(medir_tabela, quantidade, atual);
+
+    double mb = 1024.0 * 1024.0;
+    printf("estrutura,eventos,residente_mb,contabilizado_mb,textos_mb,sem_trigramas_mb,bytes_por_evento\n");
+    printf("lista_de_nos,%d,%.1f,%.1f,%.1f,%.1f,%.0f\n", quantidade, antiga[0] / mb, antiga[1] / mb,
+           antiga[2] / mb, (antiga[1] - antiga[3]) / mb, (double)antiga[0] / quantidade);
+    printf("tabela,%d,%.1f,%.1f,%.1f,%.1f,%.0f\n", quantidade, atual[0] / mb, atual[1] / mb, atual[2] / mb,
+           (atual[1] - atual[3]) / mb, (double)atual[0] / quantidade);
+    fprintf(stderr, "Com a tabela: memória residente %.1fx menor; textos %.1fx; sem o índice de trigramas %.1fx\n",
+            (double)antiga[0] / (double)atual[0], (double)antiga[2] / (double)atual[2],
+            (double)(antiga[1] - antiga[3]) / (double)(atual[1] - atual[3]));
+    return EXIT_SUCCESS;
+}
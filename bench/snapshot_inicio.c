@@ -0,0 +1,61 @@
+// Benchmark da inicialização pelo snapshot binário: gera 50 mil eventos, 200 mil participantes e
+// 5 milhões de inscrições, carrega os CSVs, grava o snapshot e mede a carga dele em estruturas
+// vazias (menor de 3 cargas), ao lado da carga dos CSVs. Sai com erro se o snapshot passar da meta
+//   bench/snapshot_inicio [inscricoes] [meta_ms]        (padrão: 5000000 e 1000 ms)
+
+#define main sistema_main
+#include "../src/main.c"
+#undef main
+#include "comum.h"
+
+#define SNAPSHOT_RODADAS 3
+
+int main(int argc, char* argv[]) {
+    long inscricoes = argc > 1 ? atol(argv[1]) : 5000000L;
+    double meta = argc > 2 ? atof(argv[2]) : 1000.0;
+    if (inscricoes < 100 || meta <= 0) {
+        fprintf(stderr, "Uso: %s [inscricoes >= 100] [meta_ms > 0]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    char diretorio[] = "/tmp/bench_snapshotXXXXXX";
+    bench_entrar_diretorio_temporario(diretorio);
+    bench_gerar_csvs((int)(inscricoes / 100), (int)(inscricoes / 25), inscricoes);
+
+    TabelaEventos* eventos;
+    TabelaParticipantes* participantes;
+    ListaInscricoes* lista_inscricoes;
+    double csv = bench_carregar_csvs(&eventos, &participantes, &lista_inscricoes);
+    if (!salvar_snapshot(eventos, participantes, lista_inscricoes, ARQUIVO_SNAPSHOT, 0)) {
+        fprintf(stderr, "Falha ao gravar o snapshot\n");
+        return EXIT_FAILURE;
+    }
+    int total = lista_inscricoes->tamanho;
+    bench_liberar(eventos, participantes, lista_inscricoes);
+    struct stat info;
+    double mb = stat(ARQUIVO_SNAPSHOT, &info) == 0 ? (double)info.st_size / 1e6 : 0.0;
+
+    double melhor = 0.0;
+    bool completo = true;
+    for (int rodada = 0; rodada < SNAPSHOT_RODADAS; rodada++) {
+        eventos = tabela_eventos_criar();
+        participantes = tabela_participantes_criar();
+        lista_inscricoes = lista_inscricoes_criar();
+        int proximoIdEvento = 1, proximoIdParticipante = 1;
+        uint64_t lsn;
+        double inicio = relogio_ms();
+        bool ok = carregar_snapshot(eventos, participantes, lista_inscricoes, ARQUIVO_SNAPSHOT, &proximoIdEvento,
+                                    &proximoIdParticipante, &lsn);
+        double ms = relogio_ms() - inicio;
+        completo = completo && ok && lista_inscricoes->tamanho == total;
+        melhor = rodada == 0 || ms < melhor ? ms : melhor;
+        bench_liberar(eventos, participantes, lista_inscricoes);
+    }
+    bench_sair_diretorio_temporario(diretorio);
+
+    printf("carga,inscricoes,mb,ms\n");
+    printf("csv,%d,,%.0f\n", total, csv);
+    printf("snapshot,%d,%.1f,%.0f\n", total, mb, melhor);
+    fprintf(stderr, "Snapshot %.1fx mais rápido que os CSVs; meta de %.0f ms %s%s\n", csv / melhor, meta,
+            melhor <= meta ? "atingida" : "NÃO atingida", completo ? "" : " (ATENÇÃO: carga incompleta)");
+    return completo && melhor <= meta ? EXIT_SUCCESS : EXIT_FAILURE;
+}
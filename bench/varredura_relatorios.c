@@ -0,0 +1,151 @@
+// Benchmark das varreduras completas dos relatórios (tabela de eventos em colunas): compara as
+// varreduras de "Eventos com Vagas" e de "Estatísticas" sobre a tabela atual com as mesmas varreduras
+// sobre uma réplica da estrutura anterior (nós Evento de ~680 bytes, com os textos fixos, um malloc
+// por nó, encadeados na mesma ordem de exibição). Só a varredura é medida, sem a impressão
+//   bench/varredura_relatorios [eventos]        (padrão: 250000)
+
+#define main sistema_main
+#include "../src/main.c"
+#undef main
+#include "comum.h"
+
+#define VARREDURA_RODADAS 20       // Menor tempo de 20 varreduras de cada tipo
+
+// Réplica do nó de evento anterior à tabela em colunas
+typedef struct evento_antigo {
+    int id;
+    char nome[100];
+    char descricao[500];
+    char categoria[50];
+    char data[11];
+    int capacidade;
+    int vagasDisponiveis;
+    struct evento_antigo* proximo;
+} EventoAntigo;
+
+// Resultado de uma varredura (acumulado para o compilador não descartar o laço)
+typedef struct resultado_varredura {
+    long com_vagas;
+    long soma_vagas;
+    int max_inscricoes;
+    int id_max;
+} ResultadoVarredura;
+
+// Varreduras do relatório de eventos com vagas e do maior evento nas estatísticas, na estrutura antiga
+static void varrer_antigo(const EventoAntigo* inicio, ResultadoVarredura* r) {
+    for (const EventoAntigo* atual = inicio; atual != NULL; atual = atual->proximo) {
+        if (atual->vagasDisponiveis > 0) {
+            r->com_vagas++;
+            r->soma_vagas += atual->vagasDisponiveis;
+        }
+    }
+    for (const EventoAntigo* atual = inicio; atual != NULL; atual = atual->proximo) {
+        int inscricoes = atual->capacidade - atual->vagasDisponiveis;
+        if (inscricoes > r->max_inscricoes) {
+            r->max_inscricoes = inscricoes;
+            r->id_max = atual->id;
+        }
+    }
+}
+
+// As mesmas varreduras na tabela em colunas, como em relatorio_eventos_com_vagas (ordem de
+// exibição) e relatorio_estatisticas (colunas contíguas)
+static void varrer_tabela(const TabelaEventos* tabela, ResultadoVarredura* r) {
+    for (int pos = tabela->inicio; pos != -1; pos = tabela->proximo[pos]) {
+        if (tabela->vagasDisponiveis[pos] > 0) {
+            r->com_vagas++;
+            r->soma_vagas += tabela->vagasDisponiveis[pos];
+        }
+    }
+    const int* capacidade = tabela->capacidade;
+    const int* vagas = tabela->vagasDisponiveis;
+    for (int pos = 0; pos < tabela->usados; pos++) {
+        int inscricoes = capacidade[pos] - vagas[pos];
+        if (inscricoes > r->max_inscricoes && tabela->ativo[pos]) {
+            r->max_inscricoes = inscricoes;
+            r->id_max = tabela->id[pos];
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int quantidade = argc > 1 ? atoi(argv[1]) : 250000;
+    if (quantidade <= 0) {
+        fprintf(stderr, "Uso: %s [eventos > 0]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // Tabela atual: eventos com datas sorteadas, como no cadastro (ordem de exibição por data)
+    TabelaEventos* tabela = tabela_eventos_criar();
+    EventoAntigo* antigos = NULL;
+    EventoAntigo** nos = (EventoAntigo**)alocar_memoria((size_t)quantidade * sizeof(EventoAntigo*));
+    for (int k = 0; k < quantidade; k++) {
+        char data[11];
+        snprintf(data, sizeof(data), "%d-%02d-%02d", 2027 + (int)bench_sortear(4), 1 + (int)bench_sortear(12),
+                 1 + (int)bench_sortear(28));
+        const char* categoria = bench_categorias[bench_sortear(BENCH_CATEGORIAS)];
+        int capacidade = 10 + (int)bench_sortear(200);
+        int pos = eventos_adicionar(tabela, k + 1, "Evento", "Encontro com palestras e oficinas", categoria,
+                                    data_compactar(data), capacidade);
+        // Nove em cada dez lotados
+        int ocupadas = k % 10 == 0 ? capacidade / 2 : capacidade;
+        eventos_ajustar_vagas(tabela, pos, -ocupadas);
+
+        // Réplica antiga, criada na mesma ordem (com os textos copiados como em evento_criar)
+        EventoAntigo* no = (EventoAntigo*)alocar_memoria(sizeof(EventoAntigo));
+        no->id = k + 1;
+        strncpy(no->nome, "Evento", sizeof(no->nome) - 1);
+        no->nome[sizeof(no->nome) - 1] = '\0';
+        strncpy(no->descricao, "Encontro com palestras e oficinas", sizeof(no->descricao) - 1);
+        no->descricao[sizeof(no->descricao) - 1] = '\0';
+        strncpy(no->categoria, categoria, sizeof(no->categoria) - 1);
+        no->categoria[sizeof(no->categoria) - 1] = '\0';
+        memcpy(no->data, data, sizeof(no->data));
+        no->capacidade = capacidade;
+        no->vagasDisponiveis = capacidade - ocupadas;
+        no->proximo = NULL;
+        nos[pos] = no;
+    }
+    // Os nós antigos são encadeados na mesma ordem de exibição da tabela
+    EventoAntigo** elo = &antigos;
+    for (int pos = tabela->inicio; pos != -1; pos = tabela->proximo[pos]) {
+        *elo = nos[pos];
+        elo = &nos[pos]->proximo;
+    }
+
+    double melhor_antigo = 0.0, melhor_tabela = 0.0;
+    ResultadoVarredura antigo, atual;
+    for (int rodada = 0; rodada < VARREDURA_RODADAS; rodada++) {
+        memset(&antigo, 0, sizeof(antigo));
+        double inicio = relogio_ms();
+        varrer_antigo(antigos, &antigo);
+        double ms = relogio_ms() - inicio;
+        if (rodada == 0 || ms < melhor_antigo) {
+            melhor_antigo = ms;
+        }
+
+        memset(&atual, 0, sizeof(atual));
+        inicio = relogio_ms();
+        varrer_tabela(tabela, &atual);
+        ms = relogio_ms() - inicio;
+        if (rodada == 0 || ms < melhor_tabela) {
+            melhor_tabela = ms;
+        }
+    }
+    bool iguais = antigo.com_vagas == atual.com_vagas && antigo.soma_vagas == atual.soma_vagas &&
+                  antigo.max_inscricoes == atual.max_inscricoes;
+
+    printf("estrutura,eventos,varredura_ms,ns_por_evento\n");
+    printf("lista_de_nos,%d,%.2f,%.2f\n", quantidade, melhor_antigo, 1e6 * melhor_antigo / quantidade);
+    printf("tabela_em_colunas,%d,%.2f,%.2f\n", quantidade, melhor_tabela, 1e6 * melhor_tabela / quantidade);
+    fprintf(stderr, "%ld eventos com vagas; tabela %.1fx mais rápida%s\n", atual.com_vagas,
+            melhor_tabela > 0 ? melhor_antigo / melhor_tabela : 0.0,
+            iguais ? "" : " (ATENÇÃO: resultados diferentes)");
+
+    for (int k = 0; k < quantidade; k++) {
+        liberar_memoria(nos[k]);
+    }
+    liberar_memoria(nos);
+    tabela_eventos_destruir(tabela);
+    return iguais ? EXIT_SUCCESS : EXIT_FAILURE;
+}
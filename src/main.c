@@ -1,42 +1,232 @@
 // Sistema de Gerenciamento de Eventos
 // Desenvolvido com base no relatório técnico de Romulo Festa, Ahmad Moussa e Ali Ataya
 
+// Funções POSIX (fileno, fsync) fora do Windows
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 // Importação de bibliotecas
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <ctype.h>
 #include <time.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <limits.h>
 #include <locale.h> // Adicionado para suportar caracteres especiais
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#endif
 
 // ====== ESTRUTURAS DE DADOS ======
 
-// Estrutura para representar um evento
-typedef struct evento {
-    int id;
-    char nome[100];
-    char descricao[500];
-    char categoria[50];
-    char data[11]; // Formato YYYY-MM-DD
-    int capacidade;
-    int vagasDisponiveis;
-    struct evento* proximo;
-} Evento;
+// Entrada de um índice hash (valor NULL indica posição livre)
+typedef struct entrada_indice {
+    uint64_t chave;
+    void* valor;
+} EntradaIndice;
+
+// Índice hash com endereçamento aberto e sondagem linear
+typedef struct indice_hash {
+    EntradaIndice* entradas;
+    size_t capacidade; // Sempre potência de 2
+    size_t tamanho;
+} IndiceHash;
+
+// Conjunto de IDs na ordem em que foram marcados (registros alterados desde o último checkpoint)
+typedef struct conjunto_ids {
+    int* ids;
+    int quantidade;
+    int alocados;
+    IndiceHash presentes;  // ID -> posição em ids
+} ConjuntoIds;
+
+#define DATAS_MAX_NIVEIS 16
+
+// Enlace de um nível da skip list: próximo nó e quantos nós o salto percorre
+typedef struct enlace_data {
+    struct no_data* proximo;
+    int largura;
+} EnlaceData;
+
+// Nó da skip list de datas (chave = data compactada << 32 | ID do evento)
+typedef struct no_data {
+    uint64_t chave;
+    int pos;              // Posição do evento na tabela (-1 na cabeça)
+    int niveis;
+    EnlaceData enlaces[]; // Um enlace por nível
+} NoData;
+
+// Índice ordenado por data (skip list com larguras, permite contar intervalos)
+typedef struct indice_datas {
+    NoData* cabeca;
+    int tamanho;
+    size_t bytes;
+    uint32_t semente;     // Estado do gerador usado para sortear os níveis
+} IndiceDatas;
+
+// Heap de textos: strings terminadas em '\0' guardadas em um único buffer
+typedef struct heap_textos {
+    char* dados;
+    size_t tamanho;
+    size_t capacidade;
+    size_t desperdicio; // Bytes de textos substituídos ou removidos
+} HeapTextos;
+
+// Categoria interna: nome e lista de postagem com as posições dos seus eventos
+typedef struct categoria {
+    char* nome;
+    int* eventos;
+    int quantidade;
+    int alocados;
+    long capacidade_total;  // Soma das capacidades dos eventos da categoria
+    long vagas_total;       // Soma das vagas disponíveis
+} Categoria;
+
+// Índice invertido de categorias (nome -> ID pequeno -> eventos)
+typedef struct indice_categorias {
+    Categoria* categorias;
+    int quantidade;
+    int alocadas;
+    IndiceHash por_nome;    // Hash do nome -> ID + 1
+} IndiceCategorias;
+
+// Lista de espera de um evento: fila (FIFO) das inscrições pendentes, encadeadas por
+// proxima_na_espera. Cada inscrição recebe uma senha na ordem de chegada e as saídas (promoção ou
+// cancelamento) são marcadas em uma árvore de Fenwick indexada pela senha: a posição de qualquer
+// inscrição sai em O(log n), sem percorrer a fila. Quem sai do meio continua encadeado até chegar
+// à cabeça, onde é descartado
+typedef struct fila_espera {
+    struct inscricao* inicio;
+    struct inscricao* fim;
+    int emitidas;        // Senhas emitidas desde que a fila esvaziou pela última vez
+    int aguardando;
+    int* saidas;         // Árvore de Fenwick das saídas (índices 1..alocadas)
+    int alocadas;        // Sempre potência de 2
+} FilaEspera;
+
+// Posições dos eventos cujos textos contêm um trigrama, na ordem de inclusão, compactadas: cada uma
+// é gravada como a diferença para a anterior (em zigue-zague, porque posições reaproveitadas podem
+// ser menores) em um inteiro de tamanho variável, 7 bits por byte. Com posições quase sempre
+// crescentes, a maioria das entradas ocupa 1 ou 2 bytes em vez de 4
+typedef struct lista_trigrama {
+    uint8_t* bytes;
+    uint32_t usados;
+    uint32_t alocados;
+    int quantidade;
+    int ultima;              // Última posição incluída (base da próxima diferença)
+} ListaTrigrama;
+
+// Leitura sequencial de uma lista de trigrama
+typedef struct cursor_trigrama {
+    const uint8_t* atual;
+    const uint8_t* fim;
+    int pos;
+} CursorTrigrama;
+
+// Índice invertido de trigramas dos textos dos eventos (nome, descrição e categoria) já
+// normalizados: minúsculas sem acentos, só letras, dígitos e espaço, o que deixa 37^3 trigramas
+// possíveis, endereçados diretamente. Eventos removidos ou com textos alterados deixam entradas
+// obsoletas nas listas: as buscas conferem cada candidato e o índice é refeito quando elas passam
+// da metade
+typedef struct indice_trigramas {
+    ListaTrigrama* listas;   // Uma lista por trigrama
+    size_t entradas;         // Posições em todas as listas
+    size_t obsoletas;        // ... das quais já não valem
+    uint32_t* vistos;        // Carimbo por trigrama, para contar cada um uma vez por texto
+    uint32_t carimbo;
+    int* coletados;          // Trigramas distintos do último texto coletado
+    int alocados_coletados;
+    char* rascunho;          // Textos normalizados
+    size_t alocado_rascunho;
+    uint32_t* marcas;        // Por posição: última busca que a encontrou
+    uint16_t* contagens;     // ... e quantos trigramas da busca ela tem
+    int alocadas_marcas;
+    uint32_t busca;
+} IndiceTrigramas;
+
+// Tabela de eventos em colunas (estrutura de arrays); cada evento é uma posição
+typedef struct tabela_eventos {
+    // Colunas quentes, percorridas pelos relatórios
+    int* id;
+    int* capacidade;
+    int* vagasDisponiveis;
+    uint32_t* data;      // Data compactada como AAAAMMDD
+    // Colunas frias: deslocamentos dos textos no heap
+    uint32_t* nome;
+    uint32_t* descricao;
+    // Categoria interna e posição do evento na lista de postagem da categoria
+    int* categoria;
+    int* posicao_categoria;
+    // Ordem de exibição (lista duplamente encadeada de posições)
+    int* proximo;
+    int* anterior;
+    bool* ativo;
+    // Inscrições de cada evento (lista encadeada por proxima_do_evento)
+    struct inscricao** inscricoes_inicio;
+    struct inscricao** inscricoes_fim;
+    FilaEspera** espera;     // Lista de espera de cada evento (NULL enquanto ninguém esperou)
+    int inicio;
+    int fim;
+    int livre;           // Primeira posição livre (encadeada por proximo)
+    int removidos;       // Posições de eventos removidos com inscrições canceladas ainda na memória
+    int usados;          // Posições já utilizadas, vivas ou livres
+    int alocadas;        // Capacidade das colunas
+    int tamanho;         // Eventos cadastrados
+    HeapTextos textos;
+    IndiceHash indice;   // ID do evento -> posição
+    IndiceDatas datas;   // (data, ID) -> posição, na mesma ordem de exibição
+    IndiceCategorias categorias;
+    IndiceTrigramas trigramas; // Busca textual por nome, descrição e categoria
+    ConjuntoIds alterados;   // Eventos criados, alterados ou removidos desde o último checkpoint
+} TabelaEventos;
+
+// Estrutura para representar um participante (registro de uma posição da tabela de participantes)
+// Tamanhos máximos dos textos de um participante, contando o '\0' (textos maiores são truncados)
+#define PARTICIPANTE_NOME_TAMANHO 100
+#define PARTICIPANTE_EMAIL_TAMANHO 100
+#define PARTICIPANTE_TELEFONE_TAMANHO 20
 
-// Estrutura para representar um participante
 typedef struct participante {
     int id;
-    char nome[100];
-    char email[100];
-    char telefone[20];
-    struct participante* proximo;
+    // Próxima posição com o mesmo hash de email / de telefone (cadeias dos índices de contato, -1 no fim);
+    // em posições livres ou de removidos, mesmo_email encadeia a lista livre ou a de removidos
+    int mesmo_email;
+    int mesmo_telefone;
+    uint32_t nome;     // Deslocamentos no heap de textos da tabela
+    uint32_t email;
+    uint32_t telefone;
+    bool ativo;        // false em posições livres e de participantes removidos
+    bool removido;     // Removido, mantido enquanto inscrições canceladas apontam para ele
+    // Inscrições do participante (lista encadeada por proxima_do_participante)
+    struct inscricao* inscricoes_inicio;
+    struct inscricao* inscricoes_fim;
 } Participante;
 
-// Estrutura para lista circular de participantes
-typedef struct lista_participantes {
-    Participante* inicio;
-    int tamanho;
-} ListaParticipantes;
+// Estrutura para a tabela de participantes: registros contíguos endereçados pela posição
+typedef struct tabela_participantes {
+    Participante* registros;
+    int livre;         // Primeira posição livre (encadeada por mesmo_email)
+    int removidos;     // Posições de removidos com inscrições canceladas ainda na memória (por mesmo_email)
+    int usados;        // Posições já utilizadas, vivas ou livres
+    int alocados;      // Capacidade do vetor de registros
+    int tamanho;       // Participantes cadastrados
+    IndiceHash indice; // ID do participante -> posição
+    IndiceHash por_email;    // Hash do email normalizado -> cadeia de posições (por mesmo_email)
+    IndiceHash por_telefone; // Hash do telefone normalizado -> cadeia de posições (por mesmo_telefone)
+    ConjuntoIds alterados; // Participantes criados, alterados ou removidos desde o último checkpoint
+    HeapTextos textos;     // Nome, email e telefone, só com o comprimento de cada um
+} TabelaParticipantes;
 
 // Enum para status de inscrição
 typedef enum StatusInscricao { 
@@ -47,17 +237,39 @@ typedef enum StatusInscricao {
 
 // Estrutura para representar uma inscrição
 typedef struct inscricao {
-    Participante* participante;
-    Evento* evento;
+    int participante; // Posição do participante na TabelaParticipantes
+    int evento; // Posição do evento na TabelaEventos
     char dataInscricao[11]; // Formato YYYY-MM-DD
     StatusInscricao status;
-    struct inscricao* proxima;
+    struct inscricao* proxima;                  // Ordem global de cadastro
+    struct inscricao* proxima_do_evento;        // Próxima inscrição do mesmo evento
+    struct inscricao* proxima_do_participante;  // Próxima inscrição do mesmo participante
+    struct inscricao* proxima_na_espera;        // Próxima na lista de espera do evento (pendentes)
+    int senha;                                  // Ordem de chegada na lista de espera
 } Inscricao;
 
+// Mudança de status de uma inscrição já gravada (cancelamento ou promoção da lista de espera)
+typedef struct alteracao_inscricao {
+    uint64_t chave;      // (ID participante, ID evento)
+    StatusInscricao status;
+} AlteracaoInscricao;
+
 // Estrutura para lista de inscrições
 typedef struct lista_inscricoes {
     Inscricao* inicio;
+    Inscricao* fim; // Última inscrição, para inserção em O(1)
     int tamanho;
+    int ativas;     // Inscrições não canceladas (contador mantido a cada operação)
+    IndiceHash indice; // (ID participante, ID evento) -> inscrição não cancelada
+    // Alterações desde o último checkpoint: as inscrições depois de persistidas_ate são novas
+    // e as alterações guardam, em ordem, as mudanças de status das inscrições já gravadas
+    Inscricao* persistidas_ate;
+    AlteracaoInscricao* alteracoes;
+    int quantidade_alteracoes;
+    int alocadas_alteracoes;
+    // Canceladas movidas para o arquivo morto nesta sessão e bytes dos nós devolvidos ao alocador
+    int arquivadas;
+    size_t bytes_recuperados;
 } ListaInscricoes;
 
 // ====== GERENCIAMENTO DE MEMÓRIA ======
@@ -79,1300 +291,7269 @@ void liberar_memoria(void* ptr) {
     }
 }
 
-// ====== FUNÇÕES PARA MANIPULAÇÃO DE EVENTOS ======
+// Função para redimensionar uma coluna (ou qualquer vetor) com realocação segura
+static void* coluna_redimensionar(void* coluna, size_t quantidade, size_t tamanho_item) {
+    void* nova = realloc(coluna, quantidade * tamanho_item);
+    if (nova == NULL) {
+        fprintf(stderr, "Erro de alocação de memória!\n");
+        exit(EXIT_FAILURE);
+    }
+    return nova;
+}
 
-// Função para criar um novo evento
-Evento* evento_criar(int id, const char* nome, const char* descricao, 
-                    const char* categoria, const char* data, int capacidade) {
-    Evento* novo = (Evento*)alocar_memoria(sizeof(Evento));
-    
-    novo->id = id;
-    strncpy(novo->nome, nome, sizeof(novo->nome)-1);
-    strncpy(novo->descricao, descricao, sizeof(novo->descricao)-1);
-    strncpy(novo->categoria, categoria, sizeof(novo->categoria)-1);
-    strncpy(novo->data, data, sizeof(novo->data)-1);
-    
-    novo->capacidade = capacidade;
-    novo->vagasDisponiveis = capacidade;
-    novo->proximo = NULL;
+// ====== ALOCADOR EM BLOCOS (SLAB) PARA OS NÓS ======
+
+// Compile com -DUSAR_ALOCADOR_SLAB=0 para voltar a um malloc por nó
+#ifndef USAR_ALOCADOR_SLAB
+#define USAR_ALOCADOR_SLAB 1
+#endif
+
+#define SLAB_BYTES_POR_BLOCO (64 * 1024)
+#define SLAB_ALINHAMENTO 16
+
+// Cabeçalho de um bloco contíguo de nós
+typedef struct bloco_slab {
+    struct bloco_slab* proximo;
+    size_t capacidade; // Quantidade de nós que cabem no bloco
+} BlocoSlab;
+
+// Alocador de nós de tamanho fixo para um tipo de entidade
+typedef struct slab {
+    const char* nome;
+    size_t tamanho_no;
+    BlocoSlab* blocos;      // Lista de blocos reservados (o primeiro é o atual)
+    size_t usados_bloco;    // Nós já entregues do bloco atual
+    void* livres;           // Lista de nós devolvidos para reutilização
+    size_t nos_livres;      // Tamanho da lista de livres
+    size_t nos_vivos;
+    size_t nos_reservados;  // Capacidade somada de todos os blocos
+    size_t bytes_reservados;
+} Slab;
+
+// Um slab por tipo de entidade com nós encadeados
+static Slab slab_inscricoes = { "Inscrições", 0, NULL, 0, NULL, 0, 0, 0, 0 };
+
+// Deslocamento dos nós dentro do bloco, preservando o alinhamento
+#define SLAB_CABECALHO (((sizeof(BlocoSlab) + SLAB_ALINHAMENTO - 1) / SLAB_ALINHAMENTO) * SLAB_ALINHAMENTO)
+
+#if USAR_ALOCADOR_SLAB
+// Função para reservar um novo bloco para o slab
+static void slab_novo_bloco(Slab* slab) {
+    size_t capacidade = (SLAB_BYTES_POR_BLOCO - SLAB_CABECALHO) / slab->tamanho_no;
+    if (capacidade == 0) {
+        capacidade = 1;
+    }
     
-    return novo;
-}
-// Função para destruir um evento
-void evento_destruir(Evento* evento) {
-    liberar_memoria(evento);
+    size_t bytes = SLAB_CABECALHO + capacidade * slab->tamanho_no;
+    BlocoSlab* bloco = (BlocoSlab*)alocar_memoria(bytes);
+    bloco->capacidade = capacidade;
+    bloco->proximo = slab->blocos;
+    slab->blocos = bloco;
+    slab->usados_bloco = 0;
+    slab->nos_reservados += capacidade;
+    slab->bytes_reservados += bytes;
 }
+#endif
 
-// Função para adicionar um evento à lista de eventos
-Evento* eventos_adicionar(Evento* lista, Evento* novo) {
-    if (lista == NULL) {
-        return novo;
+// Função para alocar um nó de entidade
+void* alocar_no(Slab* slab, size_t tamanho) {
+    slab->nos_vivos++;
+#if USAR_ALOCADOR_SLAB
+    if (slab->tamanho_no == 0) {
+        slab->tamanho_no = ((tamanho + SLAB_ALINHAMENTO - 1) / SLAB_ALINHAMENTO) * SLAB_ALINHAMENTO;
     }
     
-    Evento* atual = lista;
-    while (atual->proximo != NULL) {
-        atual = atual->proximo;
+    // Reutilizar primeiro os nós devolvidos
+    if (slab->livres != NULL) {
+        void* no = slab->livres;
+        slab->livres = *(void**)no;
+        slab->nos_livres--;
+        return no;
     }
     
-    atual->proximo = novo;
-    return lista;
-}
-
-// Função para buscar um evento por ID
-Evento* eventos_buscar_por_id(Evento* lista, int id) {
-    Evento* atual = lista;
-    while (atual != NULL) {
-        if (atual->id == id) {
-            return atual;
-        }
-        atual = atual->proximo;
+    if (slab->blocos == NULL || slab->usados_bloco == slab->blocos->capacidade) {
+        slab_novo_bloco(slab);
     }
-    return NULL;
+    
+    char* base = (char*)slab->blocos + SLAB_CABECALHO;
+    return base + (slab->usados_bloco++) * slab->tamanho_no;
+#else
+    slab->tamanho_no = tamanho;
+    slab->bytes_reservados += tamanho;
+    slab->nos_reservados++;
+    return alocar_memoria(tamanho);
+#endif
 }
 
-// Função para remover um evento da lista
-Evento* eventos_remover(Evento* lista, int id) {
-    if (lista == NULL) {
-        return NULL;
-    }
-    
-    // Caso especial: remover o primeiro evento da lista
-    if (lista->id == id) {
-        Evento* temp = lista->proximo;
-        evento_destruir(lista);
-        return temp;
+// Função para devolver um nó de entidade ao seu slab
+void liberar_no(Slab* slab, void* no) {
+    if (no == NULL) {
+        return;
     }
     
-    // Caso geral: remover evento do meio ou fim da lista
-    Evento* atual = lista;
-    while (atual->proximo != NULL) {
-        if (atual->proximo->id == id) {
-            Evento* temp = atual->proximo;
-            atual->proximo = temp->proximo;
-            evento_destruir(temp);
-            return lista;
-        }
-        atual = atual->proximo;
+    slab->nos_vivos--;
+#if USAR_ALOCADOR_SLAB
+    *(void**)no = slab->livres;
+    slab->livres = no;
+    slab->nos_livres++;
+#else
+    slab->bytes_reservados -= slab->tamanho_no;
+    slab->nos_reservados--;
+    liberar_memoria(no);
+#endif
+}
+
+// Função para liberar de uma vez todos os nós de um slab
+// (só tem efeito com o alocador em blocos; sem ele os nós são liberados um a um)
+void slab_liberar_tudo(Slab* slab) {
+#if USAR_ALOCADOR_SLAB
+    BlocoSlab* bloco = slab->blocos;
+    while (bloco != NULL) {
+        BlocoSlab* proximo = bloco->proximo;
+        liberar_memoria(bloco);
+        bloco = proximo;
     }
     
-    return lista;
+    slab->blocos = NULL;
+    slab->usados_bloco = 0;
+    slab->livres = NULL;
+    slab->nos_livres = 0;
+    slab->nos_vivos = 0;
+    slab->nos_reservados = 0;
+    slab->bytes_reservados = 0;
+#else
+    (void)slab;
+#endif
 }
 
-// Função para listar todos os eventos
-void eventos_listar(Evento* lista) {
-    if (lista == NULL) {
-        printf("Nenhum evento cadastrado.\n");
-        return;
+// Função para exibir as estatísticas de um slab
+// (fragmentação = nós devolvidos aguardando reuso / nós já entregues pelos blocos)
+void slab_exibir_estatisticas(const Slab* slab) {
+    double fragmentacao = 0.0;
+    size_t entregues = slab->nos_vivos + slab->nos_livres;
+    if (entregues > 0) {
+        fragmentacao = 100.0 * (double)slab->nos_livres / (double)entregues;
     }
     
-    printf("\n=== LISTA DE EVENTOS ===\n");
-    Evento* atual = lista;
-    while (atual != NULL) {
-        printf("ID: %d\n", atual->id);
-        printf("Nome: %s\n", atual->nome);
-        printf("Categoria: %s\n", atual->categoria);
-        printf("Data: %s\n", atual->data);
-        printf("Vagas: %d/%d\n", atual->vagasDisponiveis, atual->capacidade);
-        printf("--------------------\n");
-        atual = atual->proximo;
-    }
+    printf("%s: nós vivos: %zu | capacidade: %zu | bytes reservados: %zu | fragmentação: %.1f%%\n",
+           slab->nome, slab->nos_vivos, slab->nos_reservados, slab->bytes_reservados, fragmentacao);
 }
 
-// ====== FUNÇÕES PARA MANIPULAÇÃO DE PARTICIPANTES ======
+// ====== ÍNDICE HASH ======
 
-// Função para criar um novo participante
-Participante* participante_criar(int id, const char* nome, const char* email, const char* telefone) {
-    Participante* novo = (Participante*)alocar_memoria(sizeof(Participante));
-    
-    novo->id = id;
-    strncpy(novo->nome, nome, sizeof(novo->nome)-1);
-    strncpy(novo->email, email, sizeof(novo->email)-1);
-    strncpy(novo->telefone, telefone, sizeof(novo->telefone)-1);
-    
-    novo->proximo = NULL;
-    
-    return novo;
+#define INDICE_CAPACIDADE_INICIAL 16
+#define INDICE_LOTE_REGIOES 4096   // Regiões da inserção em lote (cada uma cabe no cache enquanto é preenchida)
+
+// Função de espalhamento para chaves de 64 bits (finalizador do splitmix64)
+static size_t indice_espalhar(uint64_t chave) {
+    chave ^= chave >> 30;
+    chave *= 0xbf58476d1ce4e5b9ULL;
+    chave ^= chave >> 27;
+    chave *= 0x94d049bb133111ebULL;
+    chave ^= chave >> 31;
+    return (size_t)chave;
 }
 
-// Função para destruir um participante
-void participante_destruir(Participante* participante) {
-    liberar_memoria(participante);
+// Função para montar a chave composta (participante, evento) das inscrições
+uint64_t indice_chave_inscricao(int idParticipante, int idEvento) {
+    return ((uint64_t)(uint32_t)idParticipante << 32) | (uint32_t)idEvento;
 }
 
-// Função para inicializar a lista circular de participantes
-ListaParticipantes* lista_participantes_criar() {
-    ListaParticipantes* lista = (ListaParticipantes*)alocar_memoria(sizeof(ListaParticipantes));
-    lista->inicio = NULL;
-    lista->tamanho = 0;
-    return lista;
+// Função para inicializar um índice vazio
+void indice_iniciar(IndiceHash* indice) {
+    indice->capacidade = INDICE_CAPACIDADE_INICIAL;
+    indice->tamanho = 0;
+    indice->entradas = (EntradaIndice*)alocar_memoria(indice->capacidade * sizeof(EntradaIndice));
+    memset(indice->entradas, 0, indice->capacidade * sizeof(EntradaIndice));
 }
 
-// Função para adicionar um participante à lista circular
-void lista_participantes_adicionar(ListaParticipantes* lista, Participante* novo) {
-    if (lista->inicio == NULL) {
-        lista->inicio = novo;
-        novo->proximo = novo;  // Aponta para si mesmo (circular)
-    } else {
-        Participante* ultimo = lista->inicio;
-        // Encontrar o último elemento (que aponta para o primeiro)
-        while (ultimo->proximo != lista->inicio) {
-            ultimo = ultimo->proximo;
+// Função para liberar a memória de um índice
+void indice_liberar(IndiceHash* indice) {
+    liberar_memoria(indice->entradas);
+    indice->entradas = NULL;
+    indice->capacidade = 0;
+    indice->tamanho = 0;
+}
+
+// Função para remover todas as entradas mantendo a capacidade
+void indice_limpar(IndiceHash* indice) {
+    memset(indice->entradas, 0, indice->capacidade * sizeof(EntradaIndice));
+    indice->tamanho = 0;
+}
+
+// Função para localizar a posição de uma chave (ou a posição livre onde entraria)
+static size_t indice_posicao(const IndiceHash* indice, uint64_t chave) {
+    size_t mascara = indice->capacidade - 1;
+    size_t pos = indice_espalhar(chave) & mascara;
+    while (indice->entradas[pos].valor != NULL && indice->entradas[pos].chave != chave) {
+        pos = (pos + 1) & mascara;
+    }
+    return pos;
+}
+
+// Função para dobrar a capacidade do índice e reinserir as entradas
+static void indice_redimensionar(IndiceHash* indice) {
+    EntradaIndice* antigas = indice->entradas;
+    size_t capacidade_antiga = indice->capacidade;
+
+    indice->capacidade *= 2;
+    indice->entradas = (EntradaIndice*)alocar_memoria(indice->capacidade * sizeof(EntradaIndice));
+    memset(indice->entradas, 0, indice->capacidade * sizeof(EntradaIndice));
+
+    for (size_t i = 0; i < capacidade_antiga; i++) {
+        if (antigas[i].valor != NULL) {
+            indice->entradas[indice_posicao(indice, antigas[i].chave)] = antigas[i];
         }
-        
-        novo->proximo = lista->inicio;
-        ultimo->proximo = novo;
     }
-    
-    lista->tamanho++;
+
+    liberar_memoria(antigas);
 }
 
-// Função para buscar um participante por ID
-Participante* lista_participantes_buscar_por_id(ListaParticipantes* lista, int id) {
-    if (lista->inicio == NULL) {
-        return NULL;
+// Função para reservar capacidade para uma quantidade de chaves (evita redimensionamentos em cargas em lote)
+void indice_reservar(IndiceHash* indice, size_t quantidade) {
+    size_t capacidade = indice->capacidade;
+    while (quantidade * 10 > capacidade * 7) {
+        capacidade *= 2;
+    }
+    while (indice->capacidade < capacidade) {
+        indice_redimensionar(indice);
     }
-    
-    Participante* atual = lista->inicio;
-    do {
-        if (atual->id == id) {
-            return atual;
-        }
-        atual = atual->proximo;
-    } while (atual != lista->inicio);
-    
-    return NULL;
 }
 
-// Função para remover um participante da lista circular
-void lista_participantes_remover(ListaParticipantes* lista, int id) {
-    if (lista->inicio == NULL) {
-        return;
+// Função para buscar o valor associado a uma chave
+void* indice_buscar(const IndiceHash* indice, uint64_t chave) {
+    return indice->entradas[indice_posicao(indice, chave)].valor;
+}
+
+// Função para inserir ou substituir o valor associado a uma chave
+void indice_inserir(IndiceHash* indice, uint64_t chave, void* valor) {
+    // Mantém a taxa de ocupação abaixo de 70%
+    if ((indice->tamanho + 1) * 10 > indice->capacidade * 7) {
+        indice_redimensionar(indice);
     }
-    
-    // Caso especial: lista com apenas um elemento
-    if (lista->inicio->id == id && lista->inicio->proximo == lista->inicio) {
-        participante_destruir(lista->inicio);
-        lista->inicio = NULL;
-        lista->tamanho = 0;
-        return;
+
+    size_t pos = indice_posicao(indice, chave);
+    if (indice->entradas[pos].valor == NULL) {
+        indice->entradas[pos].chave = chave;
+        indice->tamanho++;
+    }
+    indice->entradas[pos].valor = valor;
+}
+
+// Função para inserir muitas entradas de uma vez (cargas em lote). Em um índice maior que o cache, cada
+// chave cairia em um ponto aleatório dele; por isso as entradas são antes distribuídas (de forma
+// estável: com chaves repetidas, a última continua valendo) pelas INDICE_LOTE_REGIOES regiões do índice
+// onde cada uma cai, e a inserção percorre o índice de uma ponta à outra
+void indice_inserir_em_lote(IndiceHash* indice, const EntradaIndice* entradas, size_t quantidade) {
+    indice_reservar(indice, indice->tamanho + quantidade);
+    size_t mascara = indice->capacidade - 1;
+    int deslocamento = 0;
+    while ((indice->capacidade >> deslocamento) > INDICE_LOTE_REGIOES) {
+        deslocamento++;
     }
+    size_t regioes = indice->capacidade >> deslocamento;
     
-    // Caso especial: remover o primeiro elemento
-    if (lista->inicio->id == id) {
-        Participante* ultimo = lista->inicio;
-        while (ultimo->proximo != lista->inicio) {
-            ultimo = ultimo->proximo;
-        }
-        
-        Participante* temp = lista->inicio;
-        lista->inicio = lista->inicio->proximo;
-        ultimo->proximo = lista->inicio;
-        
-        participante_destruir(temp);
-        lista->tamanho--;
+    size_t* inicio = (size_t*)alocar_memoria((regioes + 1) * sizeof(size_t));
+    memset(inicio, 0, (regioes + 1) * sizeof(size_t));
+    for (size_t i = 0; i < quantidade; i++) {
+        inicio[((indice_espalhar(entradas[i].chave) & mascara) >> deslocamento) + 1]++;
+    }
+    for (size_t r = 0; r < regioes; r++) {
+        inicio[r + 1] += inicio[r];
+    }
+    EntradaIndice* distribuidas = (EntradaIndice*)alocar_memoria((quantidade + 1) * sizeof(EntradaIndice));
+    for (size_t i = 0; i < quantidade; i++) {
+        distribuidas[inicio[(indice_espalhar(entradas[i].chave) & mascara) >> deslocamento]++] = entradas[i];
+    }
+    for (size_t i = 0; i < quantidade; i++) {
+        indice_inserir(indice, distribuidas[i].chave, distribuidas[i].valor);
+    }
+    liberar_memoria(distribuidas);
+    liberar_memoria(inicio);
+}
+
+// Índices de posições guardam posição + 1, para que NULL continue marcando entrada livre
+void indice_inserir_posicao(IndiceHash* indice, uint64_t chave, int pos) {
+    indice_inserir(indice, chave, (void*)(intptr_t)(pos + 1));
+}
+
+// Função para buscar uma posição no índice (-1 se a chave não existir)
+int indice_buscar_posicao(const IndiceHash* indice, uint64_t chave) {
+    return (int)(intptr_t)indice_buscar(indice, chave) - 1;
+}
+
+// Função para remover uma chave do índice (remoção por deslocamento, sem lápides)
+void indice_remover(IndiceHash* indice, uint64_t chave) {
+    size_t mascara = indice->capacidade - 1;
+    size_t pos = indice_posicao(indice, chave);
+    if (indice->entradas[pos].valor == NULL) {
         return;
     }
-    
-    // Caso geral: remover do meio ou fim
-    Participante* atual = lista->inicio;
-    while (atual->proximo != lista->inicio) {
-        if (atual->proximo->id == id) {
-            Participante* temp = atual->proximo;
-            atual->proximo = temp->proximo;
-            participante_destruir(temp);
-            lista->tamanho--;
-            return;
+
+    // Puxa para trás as entradas seguintes cujo lugar ideal não fica entre a lacuna e elas
+    size_t livre = pos;
+    size_t atual = (pos + 1) & mascara;
+    while (indice->entradas[atual].valor != NULL) {
+        size_t ideal = indice_espalhar(indice->entradas[atual].chave) & mascara;
+        if (((atual - ideal) & mascara) >= ((atual - livre) & mascara)) {
+            indice->entradas[livre] = indice->entradas[atual];
+            livre = atual;
         }
-        atual = atual->proximo;
+        atual = (atual + 1) & mascara;
     }
+
+    indice->entradas[livre].valor = NULL;
+    indice->tamanho--;
 }
 
-// Função para listar todos os participantes
-void lista_participantes_listar(ListaParticipantes* lista) {
-    if (lista->inicio == NULL) {
-        printf("Nenhum participante cadastrado.\n");
+// Função para inicializar um conjunto de IDs vazio
+void conjunto_ids_iniciar(ConjuntoIds* conjunto) {
+    conjunto->ids = NULL;
+    conjunto->quantidade = 0;
+    conjunto->alocados = 0;
+    indice_iniciar(&conjunto->presentes);
+}
+
+// Função para marcar um ID (marcar de novo não o repete)
+void conjunto_ids_adicionar(ConjuntoIds* conjunto, int id) {
+    if (indice_buscar_posicao(&conjunto->presentes, (uint32_t)id) != -1) {
         return;
     }
-    
-    printf("\n=== LISTA DE PARTICIPANTES ===\n");
-    Participante* atual = lista->inicio;
-    do {
-        printf("ID: %d\n", atual->id);
-        printf("Nome: %s\n", atual->nome);
-        printf("Email: %s\n", atual->email);
-        printf("Telefone: %s\n", atual->telefone);
-        printf("--------------------\n");
-        atual = atual->proximo;
-    } while (atual != lista->inicio);
+    if (conjunto->quantidade == conjunto->alocados) {
+        conjunto->alocados = conjunto->alocados == 0 ? 16 : conjunto->alocados * 2;
+        int* novos = (int*)alocar_memoria((size_t)conjunto->alocados * sizeof(int));
+        if (conjunto->quantidade > 0) {
+            memcpy(novos, conjunto->ids, (size_t)conjunto->quantidade * sizeof(int));
+        }
+        liberar_memoria(conjunto->ids);
+        conjunto->ids = novos;
+    }
+    indice_inserir_posicao(&conjunto->presentes, (uint32_t)id, conjunto->quantidade);
+    conjunto->ids[conjunto->quantidade++] = id;
 }
 
-// Função para destruir a lista de participantes
-void lista_participantes_destruir(ListaParticipantes* lista) {
-    if (lista->inicio == NULL) {
-        liberar_memoria(lista);
-        return;
+// Função para esvaziar o conjunto (custo proporcional aos IDs marcados)
+void conjunto_ids_limpar(ConjuntoIds* conjunto) {
+    for (int k = 0; k < conjunto->quantidade; k++) {
+        indice_remover(&conjunto->presentes, (uint32_t)conjunto->ids[k]);
     }
-    
-    Participante* atual = lista->inicio;
-    Participante* proximo;
-    
-    do {
-        proximo = atual->proximo;
-        participante_destruir(atual);
-        atual = proximo;
-    } while (atual != lista->inicio);
-    
-    liberar_memoria(lista);
+    conjunto->quantidade = 0;
 }
 
-// ====== FUNÇÕES PARA MANIPULAÇÃO DE INSCRIÇÕES ======
+// Função para liberar a memória de um conjunto
+void conjunto_ids_liberar(ConjuntoIds* conjunto) {
+    liberar_memoria(conjunto->ids);
+    indice_liberar(&conjunto->presentes);
+}
 
-// Função para criar uma lista de inscrições
-ListaInscricoes* lista_inscricoes_criar() {
-    ListaInscricoes* lista = (ListaInscricoes*)alocar_memoria(sizeof(ListaInscricoes));
-    lista->inicio = NULL;
-    lista->tamanho = 0;
-    return lista;
+// ====== ÍNDICE ORDENADO POR DATA (SKIP LIST) ======
+
+// Função para sortear a quantidade de níveis de um novo nó (probabilidade 1/4 por nível)
+static int indice_datas_sortear_niveis(IndiceDatas* indice) {
+    int niveis = 1;
+    while (niveis < DATAS_MAX_NIVEIS) {
+        // xorshift32
+        indice->semente ^= indice->semente << 13;
+        indice->semente ^= indice->semente >> 17;
+        indice->semente ^= indice->semente << 5;
+        if ((indice->semente & 3) != 0) {
+            break;
+        }
+        niveis++;
+    }
+    return niveis;
 }
 
-// Função para criar uma nova inscrição
-Inscricao* inscricao_criar(Participante* participante, Evento* evento, const char* dataInscricao, StatusInscricao status) {
-    Inscricao* nova = (Inscricao*)alocar_memoria(sizeof(Inscricao));
-    
-    nova->participante = participante;
-    nova->evento = evento;
-    strncpy(nova->dataInscricao, dataInscricao, sizeof(nova->dataInscricao)-1);
-    nova->status = status;
-    nova->proxima = NULL;
-    
-    return nova;
+// Função para criar um nó com a quantidade de níveis informada
+static NoData* indice_datas_novo_no(IndiceDatas* indice, uint64_t chave, int pos, int niveis) {
+    size_t bytes = sizeof(NoData) + (size_t)niveis * sizeof(EnlaceData);
+    NoData* no = (NoData*)alocar_memoria(bytes);
+    no->chave = chave;
+    no->pos = pos;
+    no->niveis = niveis;
+    for (int l = 0; l < niveis; l++) {
+        no->enlaces[l].proximo = NULL;
+        no->enlaces[l].largura = 1;
+    }
+    indice->bytes += bytes;
+    return no;
 }
 
-// Função para destruir uma inscrição
-void inscricao_destruir(Inscricao* inscricao) {
-    liberar_memoria(inscricao);
+// Função para inicializar um índice de datas vazio
+void indice_datas_iniciar(IndiceDatas* indice) {
+    indice->semente = 2463534242u;
+    indice->tamanho = 0;
+    indice->bytes = 0;
+    indice->cabeca = indice_datas_novo_no(indice, 0, -1, DATAS_MAX_NIVEIS);
 }
 
-// Função para verificar se um participante já está inscrito em um evento
-bool inscricao_existe(ListaInscricoes* lista, int idParticipante, int idEvento) {
-    Inscricao* atual = lista->inicio;
-    
+// Função para liberar todos os nós, mantendo apenas a cabeça
+void indice_datas_limpar(IndiceDatas* indice) {
+    NoData* atual = indice->cabeca->enlaces[0].proximo;
     while (atual != NULL) {
-        if (atual->participante->id == idParticipante && 
-            atual->evento->id == idEvento && 
-            atual->status != CANCELADA) {
-            return true;
-        }
-        atual = atual->proxima;
+        NoData* proximo = atual->enlaces[0].proximo;
+        indice->bytes -= sizeof(NoData) + (size_t)atual->niveis * sizeof(EnlaceData);
+        liberar_memoria(atual);
+        atual = proximo;
     }
-    
-    return false;
+    for (int l = 0; l < DATAS_MAX_NIVEIS; l++) {
+        indice->cabeca->enlaces[l].proximo = NULL;
+        indice->cabeca->enlaces[l].largura = 1;
+    }
+    indice->tamanho = 0;
 }
 
-// Função para adicionar uma inscrição à lista
-void lista_inscricoes_adicionar(ListaInscricoes* lista, Inscricao* nova) {
-    if (lista->inicio == NULL) {
-        lista->inicio = nova;
-    } else {
-        Inscricao* atual = lista->inicio;
-        while (atual->proxima != NULL) {
-            atual = atual->proxima;
+// Função para liberar a memória de um índice de datas
+void indice_datas_liberar(IndiceDatas* indice) {
+    indice_datas_limpar(indice);
+    liberar_memoria(indice->cabeca);
+    indice->cabeca = NULL;
+    indice->bytes = 0;
+}
+
+// Função para descer pelo índice até os antecessores de uma chave
+// (preenche anteriores/posicoes por nível e devolve quantos nós têm chave menor)
+static int indice_datas_procurar(const IndiceDatas* indice, uint64_t chave,
+                                 NoData** anteriores, int* posicoes) {
+    NoData* atual = indice->cabeca;
+    int posicao = 0;
+    for (int l = DATAS_MAX_NIVEIS - 1; l >= 0; l--) {
+        while (atual->enlaces[l].proximo != NULL && atual->enlaces[l].proximo->chave < chave) {
+            posicao += atual->enlaces[l].largura;
+            atual = atual->enlaces[l].proximo;
+        }
+        if (anteriores != NULL) {
+            anteriores[l] = atual;
+            posicoes[l] = posicao;
         }
-        atual->proxima = nova;
     }
-    
-    lista->tamanho++;
+    return posicao;
 }
 
-// Função para cancelar uma inscrição
-bool lista_inscricoes_cancelar(ListaInscricoes* lista, int idParticipante, int idEvento) {
-    Inscricao* atual = lista->inicio;
+// Função para inserir uma chave; devolve a posição do evento anterior na ordem (-1 se for o primeiro)
+int indice_datas_inserir(IndiceDatas* indice, uint64_t chave, int pos) {
+    NoData* anteriores[DATAS_MAX_NIVEIS];
+    int posicoes[DATAS_MAX_NIVEIS];
+    indice_datas_procurar(indice, chave, anteriores, posicoes);
     
-    while (atual != NULL) {
-        if (atual->participante->id == idParticipante && 
-            atual->evento->id == idEvento && 
-            atual->status == CONFIRMADA) {
-            
-            atual->status = CANCELADA;
-            atual->evento->vagasDisponiveis++;
-            
-            return true;
+    int niveis = indice_datas_sortear_niveis(indice);
+    NoData* novo = indice_datas_novo_no(indice, chave, pos, niveis);
+    
+    for (int l = 0; l < DATAS_MAX_NIVEIS; l++) {
+        EnlaceData* enlace = &anteriores[l]->enlaces[l];
+        if (l < niveis) {
+            // O novo nó divide o salto anterior em dois
+            int ate_novo = posicoes[0] - posicoes[l] + 1;
+            novo->enlaces[l].proximo = enlace->proximo;
+            novo->enlaces[l].largura = enlace->largura - ate_novo + 1;
+            enlace->proximo = novo;
+            enlace->largura = ate_novo;
+        } else {
+            // Saltos acima do novo nó passam a cobrir um elemento a mais
+            enlace->largura++;
         }
-        atual = atual->proxima;
     }
     
-    return false;
+    indice->tamanho++;
+    return anteriores[0]->pos;
 }
 
-// Função para listar inscrições por evento
-void lista_inscricoes_por_evento(ListaInscricoes* lista, int idEvento) {
-    Inscricao* atual = lista->inicio;
-    bool encontrado = false;
+// Função para remover uma chave do índice
+void indice_datas_remover(IndiceDatas* indice, uint64_t chave) {
+    NoData* anteriores[DATAS_MAX_NIVEIS];
+    int posicoes[DATAS_MAX_NIVEIS];
+    indice_datas_procurar(indice, chave, anteriores, posicoes);
     
-    printf("\n=== INSCRIÇÕES DO EVENTO ID %d ===\n", idEvento);
+    NoData* alvo = anteriores[0]->enlaces[0].proximo;
+    if (alvo == NULL || alvo->chave != chave) {
+        return;
+    }
     
-    while (atual != NULL) {
-        if (atual->evento->id == idEvento && atual->status == CONFIRMADA) {
-            printf("Participante: %s (ID: %d)\n", 
-                   atual->participante->nome, 
-                   atual->participante->id);
-            printf("Data de inscrição: %s\n", atual->dataInscricao);
-            printf("--------------------\n");
-            encontrado = true;
+    for (int l = 0; l < DATAS_MAX_NIVEIS; l++) {
+        EnlaceData* enlace = &anteriores[l]->enlaces[l];
+        if (enlace->proximo == alvo) {
+            enlace->largura += alvo->enlaces[l].largura - 1;
+            enlace->proximo = alvo->enlaces[l].proximo;
+        } else {
+            enlace->largura--;
         }
-        atual = atual->proxima;
     }
     
-    if (!encontrado) {
-        printf("Nenhuma inscrição encontrada para este evento.\n");
-    }
+    indice->bytes -= sizeof(NoData) + (size_t)alvo->niveis * sizeof(EnlaceData);
+    liberar_memoria(alvo);
+    indice->tamanho--;
 }
 
-// Função para listar inscrições por participante
-void lista_inscricoes_por_participante(ListaInscricoes* lista, int idParticipante) {
-    Inscricao* atual = lista->inicio;
-    bool encontrado = false;
+// Função para reconstruir o índice em O(n) a partir de chaves já ordenadas
+void indice_datas_construir(IndiceDatas* indice, const uint64_t* chaves, const int* posicoes, int n) {
+    NoData* ultimos[DATAS_MAX_NIVEIS];
+    int ordem_ultimos[DATAS_MAX_NIVEIS];
     
-    printf("\n=== INSCRIÇÕES DO PARTICIPANTE ID %d ===\n", idParticipante);
+    indice_datas_limpar(indice);
+    for (int l = 0; l < DATAS_MAX_NIVEIS; l++) {
+        ultimos[l] = indice->cabeca;
+        ordem_ultimos[l] = 0;
+    }
     
-    while (atual != NULL) {
-        if (atual->participante->id == idParticipante && atual->status == CONFIRMADA) {
-            printf("Evento: %s (ID: %d)\n", 
-                   atual->evento->nome, 
-                   atual->evento->id);
-            printf("Data: %s\n", atual->evento->data);
-            printf("Data de inscrição: %s\n", atual->dataInscricao);
-            printf("--------------------\n");
-            encontrado = true;
+    for (int i = 0; i < n; i++) {
+        int niveis = indice_datas_sortear_niveis(indice);
+        NoData* novo = indice_datas_novo_no(indice, chaves[i], posicoes[i], niveis);
+        for (int l = 0; l < niveis; l++) {
+            ultimos[l]->enlaces[l].proximo = novo;
+            ultimos[l]->enlaces[l].largura = (i + 1) - ordem_ultimos[l];
+            ultimos[l] = novo;
+            ordem_ultimos[l] = i + 1;
         }
-        atual = atual->proxima;
     }
     
-    if (!encontrado) {
-        printf("Nenhuma inscrição encontrada para este participante.\n");
+    // O último nó de cada nível aponta para o "fim" (ordem n + 1)
+    for (int l = 0; l < DATAS_MAX_NIVEIS; l++) {
+        ultimos[l]->enlaces[l].largura = (n + 1) - ordem_ultimos[l];
     }
+    indice->tamanho = n;
 }
 
-// Função para destruir a lista de inscrições
-void lista_inscricoes_destruir(ListaInscricoes* lista) {
-    Inscricao* atual = lista->inicio;
-    Inscricao* proxima;
-    
-    while (atual != NULL) {
-        proxima = atual->proxima;
-        inscricao_destruir(atual);
-        atual = proxima;
-    }
-    
-    liberar_memoria(lista);
+// Função para obter o primeiro nó com chave maior ou igual à informada
+NoData* indice_datas_primeiro_a_partir(const IndiceDatas* indice, uint64_t chave) {
+    NoData* anteriores[DATAS_MAX_NIVEIS];
+    int posicoes[DATAS_MAX_NIVEIS];
+    indice_datas_procurar(indice, chave, anteriores, posicoes);
+    return anteriores[0]->enlaces[0].proximo;
 }
 
-// ====== ALGORITMOS DE ORDENAÇÃO ======
-
-// Função para trocar dois eventos (utilizada no QuickSort)
-void trocar_eventos(Evento* a, Evento* b) {
-    Evento temp = *a;
-    *a = *b;
-    *b = temp;
-    
-    // Correção dos ponteiros proximo após a troca
-    temp.proximo = a->proximo;
-    a->proximo = b->proximo;
-    b->proximo = temp.proximo;
+// Função para contar as chaves no intervalo [inicio, fim) em O(log n)
+int indice_datas_contar(const IndiceDatas* indice, uint64_t inicio, uint64_t fim) {
+    return indice_datas_procurar(indice, fim, NULL, NULL) -
+           indice_datas_procurar(indice, inicio, NULL, NULL);
 }
 
-// Função de particionamento para o QuickSort (ordenação por data)
-int particionar_por_data(Evento eventos[], int baixo, int alto) {
-    char* pivo = eventos[alto].data;
-    int i = (baixo - 1);
-    
-    for (int j = baixo; j <= alto - 1; j++) {
-        if (strcmp(eventos[j].data, pivo) <= 0) {
-            i++;
-            trocar_eventos(&eventos[i], &eventos[j]);
-        }
-    }
-    trocar_eventos(&eventos[i + 1], &eventos[alto]);
-    return (i + 1);
+// ====== ARMAZENAMENTO DE TEXTOS ======
+
+#define HEAP_TEXTOS_CAPACIDADE_INICIAL 4096
+
+// Função para inicializar um heap de textos vazio
+void heap_textos_iniciar(HeapTextos* heap) {
+    heap->capacidade = HEAP_TEXTOS_CAPACIDADE_INICIAL;
+    heap->dados = (char*)alocar_memoria(heap->capacidade);
+    // O deslocamento 0 é sempre a string vazia
+    heap->dados[0] = '\0';
+    heap->tamanho = 1;
+    heap->desperdicio = 0;
 }
 
-// Implementação do QuickSort para ordenar eventos por data
-void quicksort_eventos_por_data(Evento eventos[], int baixo, int alto) {
-    if (baixo < alto) {
-        int pi = particionar_por_data(eventos, baixo, alto);
-        
-        quicksort_eventos_por_data(eventos, baixo, pi - 1);
-        quicksort_eventos_por_data(eventos, pi + 1, alto);
-    }
+// Função para liberar a memória de um heap de textos
+void heap_textos_liberar(HeapTextos* heap) {
+    liberar_memoria(heap->dados);
+    heap->dados = NULL;
+    heap->tamanho = 0;
+    heap->capacidade = 0;
 }
 
-// Função para ordenar eventos por data
-void ordenar_eventos_por_data(Evento* lista, int tamanho) {
-    if (lista == NULL || tamanho <= 1) {
+// Função para garantir espaço no heap para mais uma quantidade de bytes (cargas em lote)
+void heap_textos_reservar(HeapTextos* heap, size_t bytes) {
+    if (heap->tamanho + bytes <= heap->capacidade) {
         return;
     }
-    
-    // Copiar eventos para um array para facilitar a ordenação
-    Evento* eventos_array = (Evento*)alocar_memoria(tamanho * sizeof(Evento));
-    
-    Evento* atual = lista;
-    int i = 0;
-    while (atual != NULL && i < tamanho) {
-        eventos_array[i] = *atual;
-        atual = atual->proximo;
-        i++;
+    size_t nova_capacidade = heap->capacidade * 2;
+    while (heap->tamanho + bytes > nova_capacidade) {
+        nova_capacidade *= 2;
     }
-    
-    // Ordenar o array usando QuickSort
-    quicksort_eventos_por_data(eventos_array, 0, tamanho - 1);
-    
-    // Reconstruir a lista encadeada com os eventos ordenados
-    atual = lista;
-    for (i = 0; i < tamanho; i++) {
-        *atual = eventos_array[i];
-        atual = atual->proximo;
+    char* novos = (char*)realloc(heap->dados, nova_capacidade);
+    if (novos == NULL) {
+        fprintf(stderr, "Erro de alocação de memória!\n");
+        exit(EXIT_FAILURE);
     }
-    
-    liberar_memoria(eventos_array);
+    heap->dados = novos;
+    heap->capacidade = nova_capacidade;
 }
 
-// ====== FUNÇÕES DE UTILIDADE ======
-
+// Função para copiar para o heap os primeiros bytes de um texto, devolvendo seu deslocamento
+uint32_t heap_textos_adicionar_trecho(HeapTextos* heap, const char* texto, size_t comprimento) {
+    if (comprimento == 0) {
+        return 0;
+    }
+    
+    // Os deslocamentos têm 32 bits: um heap que passaria disso é tratado como falta de memória
+    if (heap->tamanho + comprimento + 1 > UINT32_MAX) {
+        fprintf(stderr, "Erro de alocação de memória!\n");
+        exit(EXIT_FAILURE);
+    }
+    heap_textos_reservar(heap, comprimento + 1);
+    uint32_t deslocamento = (uint32_t)heap->tamanho;
+    memcpy(heap->dados + heap->tamanho, texto, comprimento);
+    heap->dados[heap->tamanho + comprimento] = '\0';
+    heap->tamanho += comprimento + 1;
+    return deslocamento;
+}
+
+// Função para copiar um texto para o heap, devolvendo seu deslocamento
+uint32_t heap_textos_adicionar(HeapTextos* heap, const char* texto) {
+    return heap_textos_adicionar_trecho(heap, texto, strlen(texto));
+}
+
+// Função para obter um texto do heap (válido até a próxima inserção)
+const char* heap_textos_obter(const HeapTextos* heap, uint32_t deslocamento) {
+    return heap->dados + deslocamento;
+}
+
+// Função para contabilizar um texto que deixou de ser referenciado
+void heap_textos_descartar(HeapTextos* heap, uint32_t deslocamento) {
+    if (deslocamento != 0) {
+        heap->desperdicio += strlen(heap->dados + deslocamento) + 1;
+    }
+}
+
+// ====== DATAS ======
+
+// Função para compactar uma data YYYY-MM-DD em um inteiro AAAAMMDD (0 se inválida)
+uint32_t data_compactar(const char* data) {
+    int ano, mes, dia;
+    if (sscanf(data, "%4d-%2d-%2d", &ano, &mes, &dia) != 3 ||
+        ano < 1 || mes < 1 || mes > 12 || dia < 1 || dia > 31) {
+        return 0;
+    }
+    return (uint32_t)(ano * 10000 + mes * 100 + dia);
+}
+
+// Função para compactar uma data exatamente no formato YYYY-MM-DD, sem sscanf (0 se inválida)
+uint32_t data_compactar_estrita(const char* data, size_t comprimento) {
+    static const int digitos[8] = { 0, 1, 2, 3, 5, 6, 8, 9 };
+    if (comprimento != 10 || data[4] != '-' || data[7] != '-') {
+        return 0;
+    }
+    for (int k = 0; k < 8; k++) {
+        if (data[digitos[k]] < '0' || data[digitos[k]] > '9') {
+            return 0;
+        }
+    }
+    int ano = (data[0] - '0') * 1000 + (data[1] - '0') * 100 + (data[2] - '0') * 10 + (data[3] - '0');
+    int mes = (data[5] - '0') * 10 + (data[6] - '0');
+    int dia = (data[8] - '0') * 10 + (data[9] - '0');
+    if (ano < 1 || mes < 1 || mes > 12 || dia < 1 || dia > 31) {
+        return 0;
+    }
+    return (uint32_t)(ano * 10000 + mes * 100 + dia);
+}
+
+// Função para formatar uma data compactada como YYYY-MM-DD (destino com 11 bytes)
+void data_formatar(uint32_t data, char* destino) {
+    unsigned ano = (data / 10000) % 10000, mes = (data / 100) % 100, dia = data % 100;
+    destino[0] = (char)('0' + ano / 1000);
+    destino[1] = (char)('0' + ano / 100 % 10);
+    destino[2] = (char)('0' + ano / 10 % 10);
+    destino[3] = (char)('0' + ano % 10);
+    destino[4] = '-';
+    destino[5] = (char)('0' + mes / 10);
+    destino[6] = (char)('0' + mes % 10);
+    destino[7] = '-';
+    destino[8] = (char)('0' + dia / 10);
+    destino[9] = (char)('0' + dia % 10);
+    destino[10] = '\0';
+}
+
+// ====== CATEGORIAS ======
+
+// Função para calcular o hash de um texto, como nomes de categoria e contatos normalizados (FNV-1a de 64 bits)
+static uint64_t texto_hash(const char* texto) {
+    uint64_t h = 1469598103934665603ULL;
+    for (const unsigned char* c = (const unsigned char*)texto; *c != '\0'; c++) {
+        h ^= *c;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// Função para inicializar um índice de categorias vazio
+void indice_categorias_iniciar(IndiceCategorias* indice) {
+    indice->categorias = NULL;
+    indice->quantidade = 0;
+    indice->alocadas = 0;
+    indice_iniciar(&indice->por_nome);
+}
+
+// Função para buscar o ID de uma categoria pelo nome (-1 se não existir)
+int indice_categorias_buscar(const IndiceCategorias* indice, const char* nome) {
+    int id = indice_buscar_posicao(&indice->por_nome, texto_hash(nome));
+    if (id != -1 && strcmp(indice->categorias[id].nome, nome) == 0) {
+        return id;
+    }
+    if (id == -1) {
+        return -1;
+    }
+    
+    // Colisão de hash (rara): procurar pelo nome entre as categorias
+    for (int c = 0; c < indice->quantidade; c++) {
+        if (strcmp(indice->categorias[c].nome, nome) == 0) {
+            return c;
+        }
+    }
+    return -1;
+}
+
+// Função para obter o ID de uma categoria, criando-a se ainda não existir
+int indice_categorias_internar(IndiceCategorias* indice, const char* nome) {
+    int id = indice_categorias_buscar(indice, nome);
+    if (id != -1) {
+        return id;
+    }
+    
+    if (indice->quantidade == indice->alocadas) {
+        indice->alocadas = indice->alocadas == 0 ? 16 : indice->alocadas * 2;
+        Categoria* novas = (Categoria*)realloc(indice->categorias, indice->alocadas * sizeof(Categoria));
+        if (novas == NULL) {
+            fprintf(stderr, "Erro de alocação de memória!\n");
+            exit(EXIT_FAILURE);
+        }
+        indice->categorias = novas;
+    }
+    
+    id = indice->quantidade++;
+    Categoria* categoria = &indice->categorias[id];
+    size_t comprimento = strlen(nome);
+    categoria->nome = (char*)alocar_memoria(comprimento + 1);
+    memcpy(categoria->nome, nome, comprimento + 1);
+    categoria->eventos = NULL;
+    categoria->quantidade = 0;
+    categoria->alocados = 0;
+    categoria->capacidade_total = 0;
+    categoria->vagas_total = 0;
+    
+    // Em caso de colisão o hash continua com a primeira categoria e a busca recorre à varredura
+    uint64_t chave = texto_hash(nome);
+    if (indice_buscar_posicao(&indice->por_nome, chave) == -1) {
+        indice_inserir_posicao(&indice->por_nome, chave, id);
+    }
+    return id;
+}
+
+// Função para acrescentar uma posição à lista de postagem; devolve o índice ocupado na lista
+int categoria_adicionar_evento(Categoria* categoria, int pos) {
+    if (categoria->quantidade == categoria->alocados) {
+        categoria->alocados = categoria->alocados == 0 ? 8 : categoria->alocados * 2;
+        int* novos = (int*)realloc(categoria->eventos, categoria->alocados * sizeof(int));
+        if (novos == NULL) {
+            fprintf(stderr, "Erro de alocação de memória!\n");
+            exit(EXIT_FAILURE);
+        }
+        categoria->eventos = novos;
+    }
+    categoria->eventos[categoria->quantidade] = pos;
+    return categoria->quantidade++;
+}
+
+// Função para retirar o item de um índice da lista de postagem em O(1) (o último ocupa o seu lugar);
+// devolve a posição do evento movido, ou -1 se nenhum foi movido
+int categoria_remover_evento(Categoria* categoria, int indice) {
+    int ultimo = --categoria->quantidade;
+    if (indice == ultimo) {
+        return -1;
+    }
+    categoria->eventos[indice] = categoria->eventos[ultimo];
+    return categoria->eventos[indice];
+}
+
+// Função para calcular os bytes ocupados pelo índice de categorias
+size_t indice_categorias_bytes(const IndiceCategorias* indice) {
+    size_t bytes = (size_t)indice->alocadas * sizeof(Categoria) +
+                   indice->por_nome.capacidade * sizeof(EntradaIndice);
+    for (int c = 0; c < indice->quantidade; c++) {
+        bytes += strlen(indice->categorias[c].nome) + 1 +
+                 (size_t)indice->categorias[c].alocados * sizeof(int);
+    }
+    return bytes;
+}
+
+// Função para liberar a memória de um índice de categorias
+void indice_categorias_liberar(IndiceCategorias* indice) {
+    for (int c = 0; c < indice->quantidade; c++) {
+        liberar_memoria(indice->categorias[c].nome);
+        liberar_memoria(indice->categorias[c].eventos);
+    }
+    liberar_memoria(indice->categorias);
+    indice->categorias = NULL;
+    indice->quantidade = 0;
+    indice->alocadas = 0;
+    indice_liberar(&indice->por_nome);
+}
+
+// ====== BUSCA TEXTUAL (TRIGRAMAS) ======
+
+#define TRIGRAMA_SIMBOLOS 37    // Espaço, a-z e 0-9
+#define TRIGRAMAS (TRIGRAMA_SIMBOLOS * TRIGRAMA_SIMBOLOS * TRIGRAMA_SIMBOLOS)
+#define TRIGRAMAS_BUSCA_MAXIMO 64
+#define TRIGRAMAS_OBSOLETAS_MINIMO 4096
+#define BUSCA_RESULTADOS 20     // Eventos exibidos por busca textual
+
+// Função para normalizar um texto para a busca: letras minúsculas sem acento (o UTF-8 dos
+// caracteres latinos, U+00C0 a U+00FF) e dígitos; qualquer outro caractere separa palavras. As
+// palavras ficam separadas por um único espaço, com um espaço também no início e no fim. destino
+// precisa de strlen(texto) + 3 bytes; devolve o comprimento
+size_t texto_normalizar(const char* texto, char* destino) {
+    // Letra base de U+00C0..U+00FF, indexada pelo segundo byte do UTF-8 (0xC3 0x80..0xBF)
+    static const char sem_acento[] = "aaaaaa ceeeeiiii nooooo  uuuuy  aaaaaa ceeeeiiii nooooo  uuuuy y";
+    const unsigned char* p = (const unsigned char*)texto;
+    size_t n = 0;
+    destino[n++] = ' ';
+    while (*p != '\0') {
+        char c;
+        if (*p < 0x80) {
+            c = (char)*p++;
+            if (c >= 'A' && c <= 'Z') {
+                c = (char)(c - 'A' + 'a');
+            } else if (!((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9'))) {
+                c = ' ';
+            }
+        } else if (p[0] == 0xC3 && p[1] >= 0x80 && p[1] <= 0xBF) {
+            c = sem_acento[p[1] - 0x80];
+            p += 2;
+        } else {
+            // Outros caracteres: a sequência UTF-8 inteira vira separador
+            p++;
+            while ((*p & 0xC0) == 0x80) {
+                p++;
+            }
+            c = ' ';
+        }
+        if (c != ' ' || destino[n - 1] != ' ') {
+            destino[n++] = c;
+        }
+    }
+    if (destino[n - 1] != ' ') {
+        destino[n++] = ' ';
+    }
+    destino[n] = '\0';
+    return n;
+}
+
+// Função para obter o número de um trigrama de texto normalizado
+static int trigrama_codigo(const char* t) {
+    int codigo = 0;
+    for (int k = 0; k < 3; k++) {
+        char c = t[k];
+        codigo = codigo * TRIGRAMA_SIMBOLOS + (c == ' ' ? 0 : c <= '9' ? 27 + (c - '0') : 1 + (c - 'a'));
+    }
+    return codigo;
+}
+
+// Função para acrescentar uma posição a uma lista de trigrama
+static void lista_trigrama_acrescentar(ListaTrigrama* lista, int pos) {
+    if (lista->usados + 5 > lista->alocados) {
+        // Crescimento de 1,5x: com dezenas de milhões de entradas, a folga pesa tanto quanto elas
+        lista->alocados = lista->alocados < 16 ? 16 : lista->alocados + lista->alocados / 2;
+        lista->bytes = (uint8_t*)coluna_redimensionar(lista->bytes, lista->alocados, 1);
+    }
+    int diferenca = pos - lista->ultima;
+    uint32_t valor = diferenca >= 0 ? (uint32_t)diferenca << 1 : ((uint32_t)(-(diferenca + 1)) << 1) | 1;
+    while (valor >= 0x80) {
+        lista->bytes[lista->usados++] = (uint8_t)(valor | 0x80);
+        valor >>= 7;
+    }
+    lista->bytes[lista->usados++] = (uint8_t)valor;
+    lista->ultima = pos;
+    lista->quantidade++;
+}
+
+// Função para começar a leitura de uma lista de trigrama
+static void lista_trigrama_percorrer(const ListaTrigrama* lista, CursorTrigrama* cursor) {
+    cursor->atual = lista->bytes;
+    cursor->fim = lista->bytes + lista->usados;
+    cursor->pos = 0;
+}
+
+// Função para ler a próxima posição da lista (em cursor->pos); falso no fim da lista
+static bool lista_trigrama_proxima(CursorTrigrama* cursor) {
+    if (cursor->atual == cursor->fim) {
+        return false;
+    }
+    uint32_t valor = 0;
+    int deslocamento = 0;
+    uint8_t byte;
+    do {
+        byte = *cursor->atual++;
+        valor |= (uint32_t)(byte & 0x7F) << deslocamento;
+        deslocamento += 7;
+    } while (byte & 0x80);
+    cursor->pos += (valor & 1) ? -(int)(valor >> 1) - 1 : (int)(valor >> 1);
+    return true;
+}
+
+// Função para inicializar um índice de trigramas vazio
+void indice_trigramas_iniciar(IndiceTrigramas* indice) {
+    memset(indice, 0, sizeof(IndiceTrigramas));
+    indice->listas = (ListaTrigrama*)alocar_memoria(TRIGRAMAS * sizeof(ListaTrigrama));
+    memset(indice->listas, 0, TRIGRAMAS * sizeof(ListaTrigrama));
+    indice->vistos = (uint32_t*)alocar_memoria(TRIGRAMAS * sizeof(uint32_t));
+    memset(indice->vistos, 0, TRIGRAMAS * sizeof(uint32_t));
+}
+
+// Função para esvaziar as listas, mantendo a memória já reservada
+void indice_trigramas_limpar(IndiceTrigramas* indice) {
+    for (int t = 0; t < TRIGRAMAS; t++) {
+        indice->listas[t].usados = 0;
+        indice->listas[t].quantidade = 0;
+        indice->listas[t].ultima = 0;
+    }
+    indice->entradas = 0;
+    indice->obsoletas = 0;
+}
+
+// Função para liberar a memória de um índice de trigramas
+void indice_trigramas_liberar(IndiceTrigramas* indice) {
+    for (int t = 0; t < TRIGRAMAS; t++) {
+        liberar_memoria(indice->listas[t].bytes);
+    }
+    liberar_memoria(indice->listas);
+    liberar_memoria(indice->vistos);
+    liberar_memoria(indice->coletados);
+    liberar_memoria(indice->rascunho);
+    liberar_memoria(indice->marcas);
+    liberar_memoria(indice->contagens);
+}
+
+// Função para obter um rascunho de pelo menos o tamanho informado
+char* indice_trigramas_rascunho(IndiceTrigramas* indice, size_t tamanho) {
+    if (tamanho > indice->alocado_rascunho) {
+        indice->alocado_rascunho = tamanho * 2;
+        liberar_memoria(indice->rascunho);
+        indice->rascunho = (char*)alocar_memoria(indice->alocado_rascunho);
+    }
+    return indice->rascunho;
+}
+
+// Função para iniciar uma nova coleta de trigramas distintos
+static void indice_trigramas_nova_coleta(IndiceTrigramas* indice) {
+    if (++indice->carimbo == 0) {
+        memset(indice->vistos, 0, TRIGRAMAS * sizeof(uint32_t));
+        indice->carimbo = 1;
+    }
+}
+
+// Função para coletar um trigrama, se ainda não visto na coleta atual (devolve o total coletado)
+static int indice_trigramas_coletar(IndiceTrigramas* indice, int trigrama, int coletados) {
+    if (indice->vistos[trigrama] == indice->carimbo) {
+        return coletados;
+    }
+    indice->vistos[trigrama] = indice->carimbo;
+    if (coletados == indice->alocados_coletados) {
+        indice->alocados_coletados = indice->alocados_coletados == 0 ? 256 : indice->alocados_coletados * 2;
+        indice->coletados = (int*)coluna_redimensionar(indice->coletados, (size_t)indice->alocados_coletados,
+                                                       sizeof(int));
+    }
+    indice->coletados[coletados] = trigrama;
+    return coletados + 1;
+}
+
+// Função para coletar os trigramas distintos de um conjunto de textos (em indice->coletados);
+// os textos são normalizados juntos, como se fossem um só
+static int indice_trigramas_coletar_textos(IndiceTrigramas* indice, const char* const* textos, int quantidade) {
+    size_t tamanho = 3;
+    for (int k = 0; k < quantidade; k++) {
+        tamanho += strlen(textos[k]) + 2;
+    }
+    char* normalizado = indice_trigramas_rascunho(indice, tamanho);
+    size_t n = 1;
+    for (int k = 0; k < quantidade; k++) {
+        // Cada texto normalizado começa com o espaço em que o anterior terminou
+        n += texto_normalizar(textos[k], normalizado + n - 1) - 1;
+    }
+    
+    indice_trigramas_nova_coleta(indice);
+    int coletados = 0;
+    for (size_t i = 0; i + 3 <= n; i++) {
+        coletados = indice_trigramas_coletar(indice, trigrama_codigo(normalizado + i), coletados);
+    }
+    return coletados;
+}
+
+// Função para indexar os textos de uma posição
+void indice_trigramas_adicionar(IndiceTrigramas* indice, int pos, const char* const* textos, int quantidade) {
+    int coletados = indice_trigramas_coletar_textos(indice, textos, quantidade);
+    for (int k = 0; k < coletados; k++) {
+        lista_trigrama_acrescentar(&indice->listas[indice->coletados[k]], pos);
+    }
+    indice->entradas += (size_t)coletados;
+}
+
+// Função para dar por obsoletas as entradas de textos que deixaram de valer (as listas não são
+// percorridas: a posição continua nelas até o índice ser refeito)
+void indice_trigramas_descartar(IndiceTrigramas* indice, const char* const* textos, int quantidade) {
+    indice->obsoletas += (size_t)indice_trigramas_coletar_textos(indice, textos, quantidade);
+}
+
+// Função para verificar se o índice deve ser refeito (mais da metade das entradas obsoletas)
+bool indice_trigramas_obsoleto(const IndiceTrigramas* indice) {
+    return indice->obsoletas > TRIGRAMAS_OBSOLETAS_MINIMO && indice->obsoletas * 2 > indice->entradas;
+}
+
+// Função para marcar as posições que contêm todos os trigramas informados, contando em cada uma
+// quantos deles ela tem (as listas são percorridas da menor para a maior e uma posição repetida
+// em uma lista é contada uma vez); devolve a menor lista, cujas posições são as candidatas
+const ListaTrigrama* indice_trigramas_intersectar(IndiceTrigramas* indice, int* trigramas, int quantidade,
+                                                  int usados) {
+    if (usados > indice->alocadas_marcas) {
+        indice->marcas = (uint32_t*)coluna_redimensionar(indice->marcas, (size_t)usados, sizeof(uint32_t));
+        indice->contagens = (uint16_t*)coluna_redimensionar(indice->contagens, (size_t)usados, sizeof(uint16_t));
+        memset(indice->marcas + indice->alocadas_marcas, 0, (size_t)(usados - indice->alocadas_marcas) * sizeof(uint32_t));
+        indice->alocadas_marcas = usados;
+    }
+    if (++indice->busca == 0) {
+        memset(indice->marcas, 0, (size_t)indice->alocadas_marcas * sizeof(uint32_t));
+        indice->busca = 1;
+    }
+    
+    // Ordenar os trigramas pelo tamanho da lista (poucos: inserção)
+    for (int i = 1; i < quantidade; i++) {
+        int t = trigramas[i];
+        int j = i - 1;
+        while (j >= 0 && indice->listas[trigramas[j]].quantidade > indice->listas[t].quantidade) {
+            trigramas[j + 1] = trigramas[j];
+            j--;
+        }
+        trigramas[j + 1] = t;
+    }
+    
+    for (int k = 0; k < quantidade; k++) {
+        CursorTrigrama cursor;
+        lista_trigrama_percorrer(&indice->listas[trigramas[k]], &cursor);
+        while (lista_trigrama_proxima(&cursor)) {
+            int pos = cursor.pos;
+            if (k == 0) {
+                if (indice->marcas[pos] != indice->busca) {
+                    indice->marcas[pos] = indice->busca;
+                    indice->contagens[pos] = 1;
+                }
+            } else if (indice->marcas[pos] == indice->busca && indice->contagens[pos] == k) {
+                indice->contagens[pos] = (uint16_t)(k + 1);
+            }
+        }
+    }
+    return &indice->listas[trigramas[0]];
+}
+
+// Função para aceitar uma candidata da última interseção uma única vez: verdadeiro se ela tem
+// todos os trigramas e ainda não foi aceita
+bool indice_trigramas_aceitar(IndiceTrigramas* indice, int pos, int quantidade) {
+    if (indice->marcas[pos] != indice->busca || indice->contagens[pos] != quantidade) {
+        return false;
+    }
+    indice->contagens[pos] = (uint16_t)(quantidade + 1);
+    return true;
+}
+
+// Função para calcular os bytes ocupados pelo índice
+size_t indice_trigramas_bytes(const IndiceTrigramas* indice) {
+    size_t bytes = TRIGRAMAS * (sizeof(ListaTrigrama) + sizeof(uint32_t)) +
+                   (size_t)indice->alocadas_marcas * (sizeof(uint32_t) + sizeof(uint16_t));
+    for (int t = 0; t < TRIGRAMAS; t++) {
+        bytes += indice->listas[t].alocados;
+    }
+    return bytes;
+}
+
+// ====== FUNÇÕES PARA MANIPULAÇÃO DE EVENTOS ======
+
+#define TABELA_EVENTOS_CAPACIDADE_INICIAL 64
+
+// Função para garantir espaço para mais uma posição na tabela
+static void tabela_eventos_crescer(TabelaEventos* tabela) {
+    if (tabela->usados < tabela->alocadas) {
+        return;
+    }
+    
+    size_t n = tabela->alocadas == 0 ? TABELA_EVENTOS_CAPACIDADE_INICIAL : (size_t)tabela->alocadas * 2;
+    tabela->id = (int*)coluna_redimensionar(tabela->id, n, sizeof(int));
+    tabela->capacidade = (int*)coluna_redimensionar(tabela->capacidade, n, sizeof(int));
+    tabela->vagasDisponiveis = (int*)coluna_redimensionar(tabela->vagasDisponiveis, n, sizeof(int));
+    tabela->data = (uint32_t*)coluna_redimensionar(tabela->data, n, sizeof(uint32_t));
+    tabela->nome = (uint32_t*)coluna_redimensionar(tabela->nome, n, sizeof(uint32_t));
+    tabela->descricao = (uint32_t*)coluna_redimensionar(tabela->descricao, n, sizeof(uint32_t));
+    tabela->categoria = (int*)coluna_redimensionar(tabela->categoria, n, sizeof(int));
+    tabela->posicao_categoria = (int*)coluna_redimensionar(tabela->posicao_categoria, n, sizeof(int));
+    tabela->proximo = (int*)coluna_redimensionar(tabela->proximo, n, sizeof(int));
+    tabela->anterior = (int*)coluna_redimensionar(tabela->anterior, n, sizeof(int));
+    tabela->ativo = (bool*)coluna_redimensionar(tabela->ativo, n, sizeof(bool));
+    tabela->inscricoes_inicio = (struct inscricao**)coluna_redimensionar(tabela->inscricoes_inicio, n, sizeof(struct inscricao*));
+    tabela->inscricoes_fim = (struct inscricao**)coluna_redimensionar(tabela->inscricoes_fim, n, sizeof(struct inscricao*));
+    tabela->espera = (FilaEspera**)coluna_redimensionar(tabela->espera, n, sizeof(FilaEspera*));
+    tabela->alocadas = (int)n;
+}
+
+// Função para criar uma tabela de eventos vazia
+TabelaEventos* tabela_eventos_criar() {
+    TabelaEventos* tabela = (TabelaEventos*)alocar_memoria(sizeof(TabelaEventos));
+    memset(tabela, 0, sizeof(TabelaEventos));
+    tabela->inicio = -1;
+    tabela->fim = -1;
+    tabela->livre = -1;
+    tabela->removidos = -1;
+    heap_textos_iniciar(&tabela->textos);
+    indice_iniciar(&tabela->indice);
+    indice_datas_iniciar(&tabela->datas);
+    indice_categorias_iniciar(&tabela->categorias);
+    indice_trigramas_iniciar(&tabela->trigramas);
+    conjunto_ids_iniciar(&tabela->alterados);
+    return tabela;
+}
+
+// Função para montar a chave do índice de datas (empates de data são desfeitos pelo ID)
+static uint64_t eventos_chave_data(const TabelaEventos* tabela, int pos) {
+    return ((uint64_t)tabela->data[pos] << 32) | (uint32_t)tabela->id[pos];
+}
+
+// Função para incluir um evento na lista de postagem e nos totais da sua categoria
+static void eventos_vincular_categoria(TabelaEventos* tabela, int pos, int categoria) {
+    Categoria* c = &tabela->categorias.categorias[categoria];
+    tabela->categoria[pos] = categoria;
+    tabela->posicao_categoria[pos] = categoria_adicionar_evento(c, pos);
+    c->capacidade_total += tabela->capacidade[pos];
+    c->vagas_total += tabela->vagasDisponiveis[pos];
+}
+
+// Função para retirar um evento da lista de postagem e dos totais da sua categoria
+static void eventos_desvincular_categoria(TabelaEventos* tabela, int pos) {
+    Categoria* c = &tabela->categorias.categorias[tabela->categoria[pos]];
+    int movido = categoria_remover_evento(c, tabela->posicao_categoria[pos]);
+    if (movido != -1) {
+        tabela->posicao_categoria[movido] = tabela->posicao_categoria[pos];
+    }
+    c->capacidade_total -= tabela->capacidade[pos];
+    c->vagas_total -= tabela->vagasDisponiveis[pos];
+}
+
+// Função para reunir os textos pesquisáveis de um evento: nome, descrição e categoria
+static void eventos_textos_busca(const TabelaEventos* tabela, int pos, const char* textos[3]) {
+    textos[0] = heap_textos_obter(&tabela->textos, tabela->nome[pos]);
+    textos[1] = heap_textos_obter(&tabela->textos, tabela->descricao[pos]);
+    textos[2] = tabela->categorias.categorias[tabela->categoria[pos]].nome;
+}
+
+// Função para incluir os textos atuais de um evento no índice de trigramas
+static void eventos_indexar_textos(TabelaEventos* tabela, int pos) {
+    const char* textos[3];
+    eventos_textos_busca(tabela, pos, textos);
+    indice_trigramas_adicionar(&tabela->trigramas, pos, textos, 3);
+}
+
+// Função para dar por obsoletas as entradas dos textos atuais de um evento (antes de alterá-los
+// ou de remover o evento)
+static void eventos_desindexar_textos(TabelaEventos* tabela, int pos) {
+    const char* textos[3];
+    eventos_textos_busca(tabela, pos, textos);
+    indice_trigramas_descartar(&tabela->trigramas, textos, 3);
+}
+
+// Função para refazer o índice de trigramas com os eventos vivos quando ele tem obsoletas demais
+// (O(entradas), amortizado pelas alterações que as tornaram obsoletas)
+static void eventos_manter_trigramas(TabelaEventos* tabela) {
+    if (!indice_trigramas_obsoleto(&tabela->trigramas)) {
+        return;
+    }
+    indice_trigramas_limpar(&tabela->trigramas);
+    for (int pos = tabela->inicio; pos != -1; pos = tabela->proximo[pos]) {
+        eventos_indexar_textos(tabela, pos);
+    }
+}
+
+// Função para ocupar uma posição com textos já guardados no heap e a categoria já internada
+// (o evento ainda fica fora da ordem de exibição)
+static int eventos_ocupar_posicao(TabelaEventos* tabela, int id, uint32_t nome, uint32_t descricao,
+                                  int categoria, uint32_t data, int capacidade) {
+    int pos;
+    if (tabela->livre != -1) {
+        // Reutilizar uma posição liberada por remoção
+        pos = tabela->livre;
+        tabela->livre = tabela->proximo[pos];
+    } else {
+        tabela_eventos_crescer(tabela);
+        pos = tabela->usados++;
+    }
+    
+    tabela->id[pos] = id;
+    tabela->capacidade[pos] = capacidade;
+    tabela->vagasDisponiveis[pos] = capacidade;
+    tabela->data[pos] = data;
+    tabela->nome[pos] = nome;
+    tabela->descricao[pos] = descricao;
+    tabela->ativo[pos] = true;
+    tabela->inscricoes_inicio[pos] = NULL;
+    tabela->inscricoes_fim[pos] = NULL;
+    tabela->espera[pos] = NULL;
+    eventos_vincular_categoria(tabela, pos, categoria);
+    eventos_indexar_textos(tabela, pos);
+    
+    indice_inserir_posicao(&tabela->indice, (uint32_t)id, pos);
+    tabela->tamanho++;
+    return pos;
+}
+
+// Função para ocupar uma posição com os dados de um novo evento (ainda fora da ordem de exibição)
+static int eventos_nova_posicao(TabelaEventos* tabela, int id, const char* nome, const char* descricao,
+                                const char* categoria, uint32_t data, int capacidade) {
+    return eventos_ocupar_posicao(tabela, id, heap_textos_adicionar(&tabela->textos, nome),
+                                  heap_textos_adicionar(&tabela->textos, descricao),
+                                  indice_categorias_internar(&tabela->categorias, categoria), data, capacidade);
+}
+
+// Função para encadear uma posição logo após outra (anterior == -1 insere no início)
+static void eventos_encadear_apos(TabelaEventos* tabela, int anterior, int pos) {
+    int proximo = anterior == -1 ? tabela->inicio : tabela->proximo[anterior];
+    
+    tabela->anterior[pos] = anterior;
+    tabela->proximo[pos] = proximo;
+    if (anterior == -1) {
+        tabela->inicio = pos;
+    } else {
+        tabela->proximo[anterior] = pos;
+    }
+    if (proximo == -1) {
+        tabela->fim = pos;
+    } else {
+        tabela->anterior[proximo] = pos;
+    }
+}
+
+// Função para retirar uma posição da ordem de exibição
+static void eventos_desencadear(TabelaEventos* tabela, int pos) {
+    if (tabela->anterior[pos] == -1) {
+        tabela->inicio = tabela->proximo[pos];
+    } else {
+        tabela->proximo[tabela->anterior[pos]] = tabela->proximo[pos];
+    }
+    if (tabela->proximo[pos] == -1) {
+        tabela->fim = tabela->anterior[pos];
+    } else {
+        tabela->anterior[tabela->proximo[pos]] = tabela->anterior[pos];
+    }
+}
+
+// Função para adicionar um evento à tabela na sua posição da ordem por data
+int eventos_adicionar(TabelaEventos* tabela, int id, const char* nome, const char* descricao,
+                      const char* categoria, uint32_t data, int capacidade) {
+    int pos = eventos_nova_posicao(tabela, id, nome, descricao, categoria, data, capacidade);
+    // O índice de datas informa o antecessor, então a ordem de exibição é mantida em O(log n)
+    int anterior = indice_datas_inserir(&tabela->datas, eventos_chave_data(tabela, pos), pos);
+    eventos_encadear_apos(tabela, anterior, pos);
+    conjunto_ids_adicionar(&tabela->alterados, id);
+    return pos;
+}
+
+// Função para adicionar um evento no fim da ordem de exibição
+// (carga em lote: deve ser seguida de ordenar_eventos_por_data, que refaz o índice de datas)
+int eventos_adicionar_no_fim(TabelaEventos* tabela, int id, const char* nome, const char* descricao,
+                             const char* categoria, uint32_t data, int capacidade) {
+    int pos = eventos_nova_posicao(tabela, id, nome, descricao, categoria, data, capacidade);
+    eventos_encadear_apos(tabela, tabela->fim, pos);
+    return pos;
+}
+
+// Função para alterar a data de um evento, recolocando-o na ordem por data
+void eventos_alterar_data(TabelaEventos* tabela, int pos, uint32_t nova_data) {
+    indice_datas_remover(&tabela->datas, eventos_chave_data(tabela, pos));
+    eventos_desencadear(tabela, pos);
+    
+    tabela->data[pos] = nova_data;
+    
+    int anterior = indice_datas_inserir(&tabela->datas, eventos_chave_data(tabela, pos), pos);
+    eventos_encadear_apos(tabela, anterior, pos);
+    conjunto_ids_adicionar(&tabela->alterados, tabela->id[pos]);
+}
+
+// Função para buscar a posição de um evento por ID (-1 se não existir)
+int eventos_buscar_por_id(TabelaEventos* tabela, int id) {
+    return indice_buscar_posicao(&tabela->indice, (uint32_t)id);
+}
+
+// Funções de acesso aos textos de um evento
+const char* eventos_nome(const TabelaEventos* tabela, int pos) {
+    return heap_textos_obter(&tabela->textos, tabela->nome[pos]);
+}
+
+const char* eventos_descricao(const TabelaEventos* tabela, int pos) {
+    return heap_textos_obter(&tabela->textos, tabela->descricao[pos]);
+}
+
+const char* eventos_categoria(const TabelaEventos* tabela, int pos) {
+    return tabela->categorias.categorias[tabela->categoria[pos]].nome;
+}
+
+// Função para pontuar uma palavra da busca (já normalizada, com o espaço que a antecede) em um
+// texto normalizado: 3 se é uma palavra inteira do texto, 2 se começa uma, 1 se aparece no meio
+// de uma, 0 se não aparece. Palavras de até 2 letras só valem como início de palavra
+static int busca_pontuar_palavra(const char* texto, const char* palavra, size_t comprimento) {
+    int pontos = 0;
+    for (const char* achado = strstr(texto, palavra); achado != NULL && pontos < 3;
+         achado = strstr(achado + 1, palavra)) {
+        pontos = achado[comprimento + 1] == ' ' ? 3 : 2;
+    }
+    if (pontos == 0 && comprimento > 2 && strstr(texto, palavra + 1) != NULL) {
+        pontos = 1;
+    }
+    return pontos;
+}
+
+// Função para buscar eventos por trechos de nome, descrição e categoria, sem diferenciar
+// maiúsculas nem acentos: cada palavra da consulta precisa aparecer em algum dos textos. As
+// candidatas saem do índice de trigramas e são conferidas nos textos; as mais relevantes (palavras
+// no nome, depois na categoria, depois na descrição; palavras inteiras e inícios de palavra valem
+// mais; empates pela data) vão para resultados. Devolve o total de eventos encontrados
+int eventos_buscar_texto(TabelaEventos* tabela, const char* consulta, int* resultados, int maximo,
+                         int* quantidade_resultados) {
+    IndiceTrigramas* indice = &tabela->trigramas;
+    *quantidade_resultados = 0;
+    
+    // Palavras da consulta, cada uma copiada com o espaço que a antecede (" show"), e seus trigramas
+    char* normalizada = (char*)alocar_memoria(2 * (strlen(consulta) + 3));
+    size_t n = texto_normalizar(consulta, normalizada);
+    char* copia = normalizada + n + 1;
+    const char* palavras[TRIGRAMAS_BUSCA_MAXIMO];
+    size_t comprimentos[TRIGRAMAS_BUSCA_MAXIMO];
+    int quantidade_palavras = 0;
+    int trigramas[TRIGRAMAS_BUSCA_MAXIMO];
+    int quantidade_trigramas = 0;
+    indice_trigramas_nova_coleta(indice);
+    for (size_t i = 0; i + 1 < n && quantidade_palavras < TRIGRAMAS_BUSCA_MAXIMO; ) {
+        size_t fim = i + 1;
+        while (normalizada[fim] != ' ') {
+            fim++;
+        }
+        size_t comprimento = fim - i - 1;
+        if (comprimento >= 2) {
+            // Trigramas internos da palavra; com 2 letras, o do início de palavra (" xy")
+            size_t primeiro = comprimento > 2 ? i + 1 : i;
+            for (size_t t = primeiro; t + 3 <= fim && quantidade_trigramas < TRIGRAMAS_BUSCA_MAXIMO; t++) {
+                int codigo = trigrama_codigo(normalizada + t);
+                if (indice->vistos[codigo] != indice->carimbo) {
+                    indice->vistos[codigo] = indice->carimbo;
+                    trigramas[quantidade_trigramas++] = codigo;
+                }
+            }
+            memcpy(copia, normalizada + i, comprimento + 1);
+            copia[comprimento + 1] = '\0';
+            palavras[quantidade_palavras] = copia;
+            comprimentos[quantidade_palavras] = comprimento;
+            quantidade_palavras++;
+            copia += comprimento + 2;
+        }
+        i = fim;
+    }
+    if (quantidade_trigramas == 0) {
+        liberar_memoria(normalizada);
+        return 0;
+    }
+    
+    const ListaTrigrama* candidatas = indice_trigramas_intersectar(indice, trigramas, quantidade_trigramas,
+                                                                   tabela->usados);
+    int* pontos = (int*)alocar_memoria(((size_t)maximo + 1) * sizeof(int));
+    int encontrados = 0;
+    CursorTrigrama cursor;
+    lista_trigrama_percorrer(candidatas, &cursor);
+    while (lista_trigrama_proxima(&cursor)) {
+        int pos = cursor.pos;
+        if (!indice_trigramas_aceitar(indice, pos, quantidade_trigramas) || !tabela->ativo[pos]) {
+            continue;
+        }
+        
+        // Conferir nos textos normalizados (os trigramas não garantem a palavra inteira)
+        const char* textos[3];
+        eventos_textos_busca(tabela, pos, textos);
+        size_t tamanhos[3];
+        size_t total = 0;
+        for (int c = 0; c < 3; c++) {
+            tamanhos[c] = strlen(textos[c]) + 3;
+            total += tamanhos[c];
+        }
+        char* campos = indice_trigramas_rascunho(indice, total);
+        const char* nome = campos;
+        const char* categoria = nome + tamanhos[0];
+        const char* descricao = categoria + tamanhos[2];
+        texto_normalizar(textos[0], campos);
+        texto_normalizar(textos[2], campos + tamanhos[0]);
+        texto_normalizar(textos[1], campos + tamanhos[0] + tamanhos[2]);
+        
+        int pontuacao = 0;
+        bool todas = true;
+        for (int w = 0; w < quantidade_palavras && todas; w++) {
+            int melhor = 3 * busca_pontuar_palavra(nome, palavras[w], comprimentos[w]);
+            if (melhor < 6) {
+                int p = 2 * busca_pontuar_palavra(categoria, palavras[w], comprimentos[w]);
+                melhor = p > melhor ? p : melhor;
+            }
+            if (melhor < 3) {
+                int p = busca_pontuar_palavra(descricao, palavras[w], comprimentos[w]);
+                melhor = p > melhor ? p : melhor;
+            }
+            todas = melhor > 0;
+            pontuacao += melhor;
+        }
+        if (!todas) {
+            continue;
+        }
+        encontrados++;
+        
+        // Inserir entre os melhores (mais pontos; empate: data mais cedo, depois menor ID)
+        int k = *quantidade_resultados;
+        while (k > 0) {
+            int outro = resultados[k - 1];
+            bool antes = pontuacao > pontos[k - 1] ||
+                         (pontuacao == pontos[k - 1] &&
+                          eventos_chave_data(tabela, pos) < eventos_chave_data(tabela, outro));
+            if (!antes) {
+                break;
+            }
+            if (k < maximo) {
+                resultados[k] = outro;
+                pontos[k] = pontos[k - 1];
+            }
+            k--;
+        }
+        if (k < maximo) {
+            resultados[k] = pos;
+            pontos[k] = pontuacao;
+            if (*quantidade_resultados < maximo) {
+                (*quantidade_resultados)++;
+            }
+        }
+    }
+    
+    liberar_memoria(pontos);
+    liberar_memoria(normalizada);
+    return encontrados;
+}
+
+// Função para substituir um texto de um evento no heap
+static void eventos_substituir_texto(TabelaEventos* tabela, uint32_t* campo, const char* texto) {
+    heap_textos_descartar(&tabela->textos, *campo);
+    *campo = heap_textos_adicionar(&tabela->textos, texto);
+}
+
+// Funções para alterar o nome e a descrição de um evento (reindexados na busca textual)
+void eventos_definir_nome(TabelaEventos* tabela, int pos, const char* nome) {
+    eventos_desindexar_textos(tabela, pos);
+    eventos_substituir_texto(tabela, &tabela->nome[pos], nome);
+    eventos_indexar_textos(tabela, pos);
+    eventos_manter_trigramas(tabela);
+    conjunto_ids_adicionar(&tabela->alterados, tabela->id[pos]);
+}
+
+void eventos_definir_descricao(TabelaEventos* tabela, int pos, const char* descricao) {
+    eventos_desindexar_textos(tabela, pos);
+    eventos_substituir_texto(tabela, &tabela->descricao[pos], descricao);
+    eventos_indexar_textos(tabela, pos);
+    eventos_manter_trigramas(tabela);
+    conjunto_ids_adicionar(&tabela->alterados, tabela->id[pos]);
+}
+
+// Função para mover um evento para outra categoria
+void eventos_definir_categoria(TabelaEventos* tabela, int pos, const char* categoria) {
+    int nova = indice_categorias_internar(&tabela->categorias, categoria);
+    if (nova == tabela->categoria[pos]) {
+        return;
+    }
+    eventos_desindexar_textos(tabela, pos);
+    eventos_desvincular_categoria(tabela, pos);
+    eventos_vincular_categoria(tabela, pos, nova);
+    eventos_indexar_textos(tabela, pos);
+    eventos_manter_trigramas(tabela);
+    conjunto_ids_adicionar(&tabela->alterados, tabela->id[pos]);
+}
+
+// Função para somar (ou subtrair) vagas ao total da categoria de um evento, sem tocar no evento
+// (o motor de inscrições já ocupou a vaga do evento com compare-and-swap)
+void eventos_ajustar_vagas_categoria(TabelaEventos* tabela, int pos, int diferenca) {
+    tabela->categorias.categorias[tabela->categoria[pos]].vagas_total += diferenca;
+}
+
+// Função para somar (ou subtrair) vagas disponíveis de um evento, mantendo os totais da categoria
+void eventos_ajustar_vagas(TabelaEventos* tabela, int pos, int diferenca) {
+    tabela->vagasDisponiveis[pos] += diferenca;
+    eventos_ajustar_vagas_categoria(tabela, pos, diferenca);
+}
+
+// Função para consultar as vagas livres de um evento para exibição
+// (vagasDisponiveis fica negativa quando a capacidade foi reduzida abaixo das confirmadas)
+int eventos_vagas_livres(const TabelaEventos* tabela, int pos) {
+    return tabela->vagasDisponiveis[pos] > 0 ? tabela->vagasDisponiveis[pos] : 0;
+}
+
+// Função para alterar a capacidade de um evento (as vagas acompanham a diferença e podem ficar
+// negativas: cancelamentos devolvem primeiro o excesso antes de liberar vaga para a lista de espera)
+void eventos_definir_capacidade(TabelaEventos* tabela, int pos, int capacidade) {
+    Categoria* c = &tabela->categorias.categorias[tabela->categoria[pos]];
+    int vagas = tabela->vagasDisponiveis[pos] + capacidade - tabela->capacidade[pos];
+    c->capacidade_total += capacidade - tabela->capacidade[pos];
+    c->vagas_total += vagas - tabela->vagasDisponiveis[pos];
+    tabela->capacidade[pos] = capacidade;
+    tabela->vagasDisponiveis[pos] = vagas;
+    conjunto_ids_adicionar(&tabela->alterados, tabela->id[pos]);
+}
+
+// Função para restaurar um evento no fim da ordem de exibição com textos que já estão no heap
+// (carga do snapshot binário: deve ser seguida de ordenar_eventos_por_data)
+int eventos_restaurar_no_fim(TabelaEventos* tabela, int id, uint32_t nome, uint32_t descricao,
+                             int categoria, uint32_t data, int capacidade, int vagas) {
+    int pos = eventos_ocupar_posicao(tabela, id, nome, descricao, categoria, data, capacidade);
+    eventos_ajustar_vagas(tabela, pos, vagas - capacidade);
+    eventos_encadear_apos(tabela, tabela->fim, pos);
+    return pos;
+}
+
+// Função para liberar a lista de espera de uma posição
+static void eventos_liberar_espera(TabelaEventos* tabela, int pos) {
+    if (tabela->espera[pos] != NULL) {
+        liberar_memoria(tabela->espera[pos]->saidas);
+        liberar_memoria(tabela->espera[pos]);
+        tabela->espera[pos] = NULL;
+    }
+}
+
+// Função para remover um evento da tabela
+void eventos_remover(TabelaEventos* tabela, int id) {
+    int pos = eventos_buscar_por_id(tabela, id);
+    if (pos == -1) {
+        return;
+    }
+    
+    indice_datas_remover(&tabela->datas, eventos_chave_data(tabela, pos));
+    eventos_desencadear(tabela, pos);
+    eventos_desindexar_textos(tabela, pos);
+    
+    heap_textos_descartar(&tabela->textos, tabela->nome[pos]);
+    heap_textos_descartar(&tabela->textos, tabela->descricao[pos]);
+    eventos_desvincular_categoria(tabela, pos);
+    eventos_liberar_espera(tabela, pos);
+    
+    // Devolver a posição para reutilização; se inscrições (canceladas) ainda apontam para ela, só
+    // depois que forem arquivadas (o ID continua legível até lá)
+    tabela->ativo[pos] = false;
+    if (tabela->inscricoes_inicio[pos] != NULL) {
+        tabela->proximo[pos] = tabela->removidos;
+        tabela->removidos = pos;
+    } else {
+        tabela->proximo[pos] = tabela->livre;
+        tabela->livre = pos;
+    }
+    
+    indice_remover(&tabela->indice, (uint32_t)id);
+    tabela->tamanho--;
+    eventos_manter_trigramas(tabela);
+    conjunto_ids_adicionar(&tabela->alterados, id);
+}
+
+// Função para devolver à lista livre as posições de eventos removidos, quando nenhuma inscrição
+// aponta mais para elas
+void eventos_liberar_removidos(TabelaEventos* tabela) {
+    while (tabela->removidos != -1) {
+        int pos = tabela->removidos;
+        tabela->removidos = tabela->proximo[pos];
+        tabela->inscricoes_inicio[pos] = NULL;
+        tabela->inscricoes_fim[pos] = NULL;
+        tabela->proximo[pos] = tabela->livre;
+        tabela->livre = pos;
+    }
+}
+
+// Função para listar todos os eventos
+void eventos_listar(TabelaEventos* tabela) {
+    if (tabela->inicio == -1) {
+        printf("Nenhum evento cadastrado.\n");
+        return;
+    }
+    
+    printf("\n=== LISTA DE EVENTOS ===\n");
+    char data[11];
+    for (int pos = tabela->inicio; pos != -1; pos = tabela->proximo[pos]) {
+        data_formatar(tabela->data[pos], data);
+        printf("ID: %d\n", tabela->id[pos]);
+        printf("Nome: %s\n", eventos_nome(tabela, pos));
+        printf("Categoria: %s\n", eventos_categoria(tabela, pos));
+        printf("Data: %s\n", data);
+        printf("Vagas: %d/%d\n", eventos_vagas_livres(tabela, pos), tabela->capacidade[pos]);
+        printf("--------------------\n");
+    }
+}
+
+// Função para calcular os bytes ocupados pelas colunas e pelo heap de textos
+size_t tabela_eventos_bytes(const TabelaEventos* tabela) {
+    size_t por_posicao = 6 * sizeof(int) + 3 * sizeof(uint32_t) + sizeof(int) + sizeof(bool) +
+                         2 * sizeof(struct inscricao*) + sizeof(FilaEspera*);
+    size_t espera = 0;
+    for (int pos = 0; pos < tabela->usados; pos++) {
+        if (tabela->espera[pos] != NULL) {
+            espera += sizeof(FilaEspera) + ((size_t)tabela->espera[pos]->alocadas + 1) * sizeof(int);
+        }
+    }
+    return (size_t)tabela->alocadas * por_posicao + tabela->textos.capacidade +
+           tabela->indice.capacidade * sizeof(EntradaIndice) + tabela->datas.bytes +
+           indice_categorias_bytes(&tabela->categorias) + indice_trigramas_bytes(&tabela->trigramas) + espera;
+}
+
+// Função para destruir a tabela de eventos
+void tabela_eventos_destruir(TabelaEventos* tabela) {
+    for (int pos = 0; pos < tabela->usados; pos++) {
+        eventos_liberar_espera(tabela, pos);
+    }
+    liberar_memoria(tabela->id);
+    liberar_memoria(tabela->capacidade);
+    liberar_memoria(tabela->vagasDisponiveis);
+    liberar_memoria(tabela->data);
+    liberar_memoria(tabela->nome);
+    liberar_memoria(tabela->descricao);
+    liberar_memoria(tabela->categoria);
+    liberar_memoria(tabela->posicao_categoria);
+    liberar_memoria(tabela->proximo);
+    liberar_memoria(tabela->anterior);
+    liberar_memoria(tabela->ativo);
+    liberar_memoria(tabela->inscricoes_inicio);
+    liberar_memoria(tabela->inscricoes_fim);
+    liberar_memoria(tabela->espera);
+    heap_textos_liberar(&tabela->textos);
+    indice_liberar(&tabela->indice);
+    indice_datas_liberar(&tabela->datas);
+    indice_categorias_liberar(&tabela->categorias);
+    indice_trigramas_liberar(&tabela->trigramas);
+    conjunto_ids_liberar(&tabela->alterados);
+    liberar_memoria(tabela);
+}
+
+// ====== FUNÇÕES PARA MANIPULAÇÃO DE PARTICIPANTES ======
+
+#define TABELA_PARTICIPANTES_CAPACIDADE_INICIAL 64
+
+// Função de normalização de um contato (email ou telefone) para comparação; devolve o comprimento
+typedef size_t (*NormalizarContato)(const char* texto, char* destino, size_t tamanho);
+
+// Função para normalizar um email: sem espaços nas pontas e em minúsculas
+size_t email_normalizar(const char* email, char* destino, size_t tamanho) {
+    while (isspace((unsigned char)*email)) {
+        email++;
+    }
+    size_t n = 0;
+    for (; *email != '\0' && n + 1 < tamanho; email++) {
+        destino[n++] = (char)tolower((unsigned char)*email);
+    }
+    while (n > 0 && isspace((unsigned char)destino[n - 1])) {
+        n--;
+    }
+    destino[n] = '\0';
+    return n;
+}
+
+// Função para normalizar um telefone: apenas os dígitos ("(11) 9876-5432" e "11987654321" são o mesmo)
+size_t telefone_normalizar(const char* telefone, char* destino, size_t tamanho) {
+    size_t n = 0;
+    for (; *telefone != '\0' && n + 1 < tamanho; telefone++) {
+        if (isdigit((unsigned char)*telefone)) {
+            destino[n++] = *telefone;
+        }
+    }
+    destino[n] = '\0';
+    return n;
+}
+
+// Campos de um índice de contato: onde ficam o índice na tabela, o deslocamento do texto e o elo da
+// cadeia no participante, e a normalização
+typedef struct indice_contato {
+    size_t indice;
+    size_t texto;
+    size_t elo;
+    NormalizarContato normalizar;
+} IndiceContato;
+
+static const IndiceContato CONTATO_EMAIL = {
+    offsetof(TabelaParticipantes, por_email), offsetof(Participante, email), offsetof(Participante, mesmo_email),
+    email_normalizar
+};
+static const IndiceContato CONTATO_TELEFONE = {
+    offsetof(TabelaParticipantes, por_telefone), offsetof(Participante, telefone),
+    offsetof(Participante, mesmo_telefone), telefone_normalizar
+};
+
+// Função para acessar um índice de contato da tabela
+static IndiceHash* contato_indice(const TabelaParticipantes* tabela, const IndiceContato* campos) {
+    return (IndiceHash*)((char*)tabela + campos->indice);
+}
+
+// Função para acessar o elo de um participante na cadeia de um índice de contato
+static int* contato_elo(Participante* participante, const IndiceContato* campos) {
+    return (int*)((char*)participante + campos->elo);
+}
+
+// Função para obter o texto de um participante usado por um índice de contato
+static const char* contato_texto(const TabelaParticipantes* tabela, const IndiceContato* campos, int pos) {
+    uint32_t deslocamento = *(const uint32_t*)((const char*)&tabela->registros[pos] + campos->texto);
+    return heap_textos_obter(&tabela->textos, deslocamento);
+}
+
+// Função para obter a chave de um participante em um índice de contato (false se o contato estiver vazio)
+static bool contato_chave(const TabelaParticipantes* tabela, const IndiceContato* campos, int pos,
+                          char* normalizado, uint64_t* chave) {
+    if (campos->normalizar(contato_texto(tabela, campos, pos), normalizado, PARTICIPANTE_EMAIL_TAMANHO) == 0) {
+        return false;
+    }
+    *chave = texto_hash(normalizado);
+    return true;
+}
+
+// Função para colocar uma posição no início da cadeia do seu contato
+static void contato_indexar(TabelaParticipantes* tabela, const IndiceContato* campos, int pos) {
+    Participante* participante = &tabela->registros[pos];
+    char normalizado[PARTICIPANTE_EMAIL_TAMANHO];
+    uint64_t chave;
+    *contato_elo(participante, campos) = -1;
+    if (!contato_chave(tabela, campos, pos, normalizado, &chave)) {
+        return;
+    }
+    IndiceHash* indice = contato_indice(tabela, campos);
+    *contato_elo(participante, campos) = indice_buscar_posicao(indice, chave);
+    indice_inserir_posicao(indice, chave, pos);
+}
+
+// Função para retirar uma posição da cadeia do seu contato (O(participantes com o mesmo contato))
+static void contato_desindexar(TabelaParticipantes* tabela, const IndiceContato* campos, int pos) {
+    Participante* participante = &tabela->registros[pos];
+    char normalizado[PARTICIPANTE_EMAIL_TAMANHO];
+    uint64_t chave;
+    if (!contato_chave(tabela, campos, pos, normalizado, &chave)) {
+        return;
+    }
+    IndiceHash* indice = contato_indice(tabela, campos);
+    int seguinte = *contato_elo(participante, campos);
+    int atual = indice_buscar_posicao(indice, chave);
+    if (atual == pos) {
+        if (seguinte != -1) {
+            indice_inserir_posicao(indice, chave, seguinte);
+        } else {
+            indice_remover(indice, chave);
+        }
+    } else {
+        while (atual != -1 && *contato_elo(&tabela->registros[atual], campos) != pos) {
+            atual = *contato_elo(&tabela->registros[atual], campos);
+        }
+        if (atual != -1) {
+            *contato_elo(&tabela->registros[atual], campos) = seguinte;
+        }
+    }
+    *contato_elo(participante, campos) = -1;
+}
+
+// Função para buscar a próxima posição (depois de "depois", ou a primeira se -1) com o contato dado
+static int contato_buscar(const TabelaParticipantes* tabela, const IndiceContato* campos, const char* contato,
+                          int depois) {
+    char procurado[PARTICIPANTE_EMAIL_TAMANHO];
+    char normalizado[sizeof(procurado)];
+    if (campos->normalizar(contato, procurado, sizeof(procurado)) == 0) {
+        return -1;
+    }
+    int atual = depois != -1 ? *contato_elo(&tabela->registros[depois], campos)
+                             : indice_buscar_posicao(contato_indice(tabela, campos), texto_hash(procurado));
+    // A cadeia agrupa por hash: a comparação descarta colisões (raras) entre contatos diferentes
+    for (; atual != -1; atual = *contato_elo(&tabela->registros[atual], campos)) {
+        campos->normalizar(contato_texto(tabela, campos, atual), normalizado, sizeof(normalizado));
+        if (strcmp(normalizado, procurado) == 0) {
+            return atual;
+        }
+    }
+    return -1;
+}
+
+// Função para copiar um texto de participante para o heap, truncado ao tamanho do campo
+// (os textos passados não podem estar no próprio heap, que pode ser realocado)
+static uint32_t participantes_guardar_texto(TabelaParticipantes* tabela, const char* texto, size_t tamanho) {
+    size_t comprimento = 0;
+    while (comprimento + 1 < tamanho && texto[comprimento] != '\0') {
+        comprimento++;
+    }
+    return heap_textos_adicionar_trecho(&tabela->textos, texto, comprimento);
+}
+
+// Função para trocar um texto de participante; um texto igual ao atual não ocupa o heap de novo
+static void participantes_substituir_texto(TabelaParticipantes* tabela, uint32_t* campo, const char* texto,
+                                           size_t tamanho) {
+    if (strncmp(heap_textos_obter(&tabela->textos, *campo), texto, tamanho - 1) == 0) {
+        return;
+    }
+    heap_textos_descartar(&tabela->textos, *campo);
+    *campo = participantes_guardar_texto(tabela, texto, tamanho);
+}
+
+// Função para garantir espaço no vetor de registros para mais uma posição
+static void tabela_participantes_crescer(TabelaParticipantes* tabela, int quantidade) {
+    if (quantidade <= tabela->alocados) {
+        return;
+    }
+    size_t n = tabela->alocados == 0 ? TABELA_PARTICIPANTES_CAPACIDADE_INICIAL : (size_t)tabela->alocados;
+    while (n < (size_t)quantidade) {
+        n *= 2;
+    }
+    tabela->registros = (Participante*)coluna_redimensionar(tabela->registros, n, sizeof(Participante));
+    tabela->alocados = (int)n;
+}
+
+// Função para inicializar a tabela de participantes
+TabelaParticipantes* tabela_participantes_criar() {
+    TabelaParticipantes* tabela = (TabelaParticipantes*)alocar_memoria(sizeof(TabelaParticipantes));
+    memset(tabela, 0, sizeof(TabelaParticipantes));
+    tabela->livre = -1;
+    tabela->removidos = -1;
+    indice_iniciar(&tabela->indice);
+    indice_iniciar(&tabela->por_email);
+    indice_iniciar(&tabela->por_telefone);
+    conjunto_ids_iniciar(&tabela->alterados);
+    heap_textos_iniciar(&tabela->textos);
+    return tabela;
+}
+
+// Função para reservar a tabela e os seus índices para uma quantidade de participantes (cargas em lote)
+void participantes_reservar(TabelaParticipantes* tabela, size_t quantidade) {
+    tabela_participantes_crescer(tabela, tabela->usados + (int)quantidade);
+    indice_reservar(&tabela->indice, quantidade);
+    indice_reservar(&tabela->por_email, quantidade);
+    indice_reservar(&tabela->por_telefone, quantidade);
+}
+
+// Função para ocupar uma posição com um novo participante (reaproveita uma posição livre, se houver).
+// Ponteiros para registros deixam de valer quando o vetor cresce: guarde posições
+static int participantes_ocupar_posicao(TabelaParticipantes* tabela, int id, const char* nome, const char* email,
+                                        const char* telefone) {
+    int pos;
+    if (tabela->livre != -1) {
+        pos = tabela->livre;
+        tabela->livre = tabela->registros[pos].mesmo_email;
+    } else {
+        tabela_participantes_crescer(tabela, tabela->usados + 1);
+        pos = tabela->usados++;
+    }
+    
+    Participante* novo = &tabela->registros[pos];
+    novo->id = id;
+    novo->nome = participantes_guardar_texto(tabela, nome, PARTICIPANTE_NOME_TAMANHO);
+    novo->email = participantes_guardar_texto(tabela, email, PARTICIPANTE_EMAIL_TAMANHO);
+    novo->telefone = participantes_guardar_texto(tabela, telefone, PARTICIPANTE_TELEFONE_TAMANHO);
+    novo->ativo = true;
+    novo->removido = false;
+    novo->inscricoes_inicio = NULL;
+    novo->inscricoes_fim = NULL;
+    
+    indice_inserir_posicao(&tabela->indice, (uint32_t)id, pos);
+    contato_indexar(tabela, &CONTATO_EMAIL, pos);
+    contato_indexar(tabela, &CONTATO_TELEFONE, pos);
+    tabela->tamanho++;
+    return pos;
+}
+
+// Função para adicionar um participante, marcado para o próximo checkpoint; devolve a posição
+int participantes_adicionar(TabelaParticipantes* tabela, int id, const char* nome, const char* email,
+                            const char* telefone) {
+    int pos = participantes_ocupar_posicao(tabela, id, nome, email, telefone);
+    conjunto_ids_adicionar(&tabela->alterados, id);
+    return pos;
+}
+
+// Função para restaurar um participante já gravado (carga do snapshot ou dos CSVs, sem marcá-lo)
+int participantes_restaurar(TabelaParticipantes* tabela, int id, const char* nome, const char* email,
+                            const char* telefone) {
+    return participantes_ocupar_posicao(tabela, id, nome, email, telefone);
+}
+
+// Funções para obter os textos de um participante (válidos até o próximo texto guardado na tabela)
+const char* participantes_nome(const TabelaParticipantes* tabela, int pos) {
+    return heap_textos_obter(&tabela->textos, tabela->registros[pos].nome);
+}
+
+const char* participantes_email(const TabelaParticipantes* tabela, int pos) {
+    return heap_textos_obter(&tabela->textos, tabela->registros[pos].email);
+}
+
+const char* participantes_telefone(const TabelaParticipantes* tabela, int pos) {
+    return heap_textos_obter(&tabela->textos, tabela->registros[pos].telefone);
+}
+
+// Função para buscar a posição de um participante por ID (-1 se não existir)
+int participantes_buscar_por_id(const TabelaParticipantes* tabela, int id) {
+    return indice_buscar_posicao(&tabela->indice, (uint32_t)id);
+}
+
+// Função para buscar um participante pelo email, sem diferenciar maiúsculas nem espaços nas pontas
+// (com "depois" != -1, devolve o próximo com o mesmo email, para dados antigos com repetições)
+int participantes_buscar_por_email(const TabelaParticipantes* tabela, const char* email, int depois) {
+    return contato_buscar(tabela, &CONTATO_EMAIL, email, depois);
+}
+
+// Função para buscar um participante pelo telefone, comparando apenas os dígitos
+int participantes_buscar_por_telefone(const TabelaParticipantes* tabela, const char* telefone, int depois) {
+    return contato_buscar(tabela, &CONTATO_TELEFONE, telefone, depois);
+}
+
+// Função para verificar se um email já pertence a outro participante (devolve a posição dele ou -1)
+int participantes_email_em_uso(const TabelaParticipantes* tabela, const char* email, int idIgnorado) {
+    int outro = participantes_buscar_por_email(tabela, email, -1);
+    while (outro != -1 && tabela->registros[outro].id == idIgnorado) {
+        outro = participantes_buscar_por_email(tabela, email, outro);
+    }
+    return outro;
+}
+
+// Função para alterar os dados de um participante, mantendo os índices de contato (marcado para o
+// próximo checkpoint)
+void participantes_atualizar(TabelaParticipantes* tabela, int pos, const char* nome, const char* email,
+                             const char* telefone) {
+    contato_desindexar(tabela, &CONTATO_EMAIL, pos);
+    contato_desindexar(tabela, &CONTATO_TELEFONE, pos);
+    Participante* participante = &tabela->registros[pos];
+    participantes_substituir_texto(tabela, &participante->nome, nome, PARTICIPANTE_NOME_TAMANHO);
+    participantes_substituir_texto(tabela, &participante->email, email, PARTICIPANTE_EMAIL_TAMANHO);
+    participantes_substituir_texto(tabela, &participante->telefone, telefone, PARTICIPANTE_TELEFONE_TAMANHO);
+    contato_indexar(tabela, &CONTATO_EMAIL, pos);
+    contato_indexar(tabela, &CONTATO_TELEFONE, pos);
+    conjunto_ids_adicionar(&tabela->alterados, participante->id);
+}
+
+// Função para remover um participante em O(1); a posição volta para a lista livre, ou, com inscrições
+// (canceladas) apontando para ela, fica guardada até que sejam arquivadas
+void participantes_remover(TabelaParticipantes* tabela, int id) {
+    int pos = participantes_buscar_por_id(tabela, id);
+    if (pos == -1) {
+        return;
+    }
+    
+    indice_remover(&tabela->indice, (uint32_t)id);
+    contato_desindexar(tabela, &CONTATO_EMAIL, pos);
+    contato_desindexar(tabela, &CONTATO_TELEFONE, pos);
+    Participante* alvo = &tabela->registros[pos];
+    // Os textos continuam legíveis no heap; só passam a contar como desperdício
+    heap_textos_descartar(&tabela->textos, alvo->nome);
+    heap_textos_descartar(&tabela->textos, alvo->email);
+    heap_textos_descartar(&tabela->textos, alvo->telefone);
+    alvo->ativo = false;
+    if (alvo->inscricoes_inicio != NULL) {
+        alvo->removido = true;
+        alvo->mesmo_email = tabela->removidos;
+        tabela->removidos = pos;
+    } else {
+        alvo->mesmo_email = tabela->livre;
+        tabela->livre = pos;
+    }
+    tabela->tamanho--;
+    conjunto_ids_adicionar(&tabela->alterados, id);
+}
+
+// Função para liberar as posições dos participantes removidos, quando nenhuma inscrição aponta mais para eles
+void participantes_liberar_removidos(TabelaParticipantes* tabela) {
+    while (tabela->removidos != -1) {
+        int pos = tabela->removidos;
+        Participante* removido = &tabela->registros[pos];
+        tabela->removidos = removido->mesmo_email;
+        removido->removido = false;
+        removido->inscricoes_inicio = NULL;
+        removido->inscricoes_fim = NULL;
+        removido->mesmo_email = tabela->livre;
+        tabela->livre = pos;
+    }
+}
+
+// Função para listar todos os participantes (na ordem das posições)
+void participantes_listar(TabelaParticipantes* tabela) {
+    if (tabela->tamanho == 0) {
+        printf("Nenhum participante cadastrado.\n");
+        return;
+    }
+    
+    printf("\n=== LISTA DE PARTICIPANTES ===\n");
+    for (int pos = 0; pos < tabela->usados; pos++) {
+        const Participante* atual = &tabela->registros[pos];
+        if (!atual->ativo) {
+            continue;
+        }
+        printf("ID: %d\n", atual->id);
+        printf("Nome: %s\n", participantes_nome(tabela, pos));
+        printf("Email: %s\n", participantes_email(tabela, pos));
+        printf("Telefone: %s\n", participantes_telefone(tabela, pos));
+        printf("--------------------\n");
+    }
+}
+
+// Função para calcular a memória ocupada pela tabela, pelo heap de textos e pelos índices
+size_t tabela_participantes_bytes(const TabelaParticipantes* tabela) {
+    return (size_t)tabela->alocados * sizeof(Participante) + tabela->textos.capacidade +
+           (tabela->indice.capacidade + tabela->por_email.capacidade + tabela->por_telefone.capacidade) *
+               sizeof(EntradaIndice);
+}
+
+// Função para destruir a tabela de participantes
+void tabela_participantes_destruir(TabelaParticipantes* tabela) {
+    liberar_memoria(tabela->registros);
+    indice_liberar(&tabela->indice);
+    indice_liberar(&tabela->por_email);
+    indice_liberar(&tabela->por_telefone);
+    conjunto_ids_liberar(&tabela->alterados);
+    heap_textos_liberar(&tabela->textos);
+    liberar_memoria(tabela);
+}
+
+// ====== FUNÇÕES PARA MANIPULAÇÃO DE INSCRIÇÕES ======
+
+// Função para criar uma lista de inscrições
+ListaInscricoes* lista_inscricoes_criar() {
+    ListaInscricoes* lista = (ListaInscricoes*)alocar_memoria(sizeof(ListaInscricoes));
+    lista->inicio = NULL;
+    lista->fim = NULL;
+    lista->tamanho = 0;
+    lista->ativas = 0;
+    indice_iniciar(&lista->indice);
+    lista->persistidas_ate = NULL;
+    lista->alteracoes = NULL;
+    lista->quantidade_alteracoes = 0;
+    lista->alocadas_alteracoes = 0;
+    lista->arquivadas = 0;
+    lista->bytes_recuperados = 0;
+    return lista;
+}
+
+// Função para criar uma nova inscrição
+Inscricao* inscricao_criar(int participante, int evento, const char* dataInscricao, StatusInscricao status) {
+    Inscricao* nova = (Inscricao*)alocar_no(&slab_inscricoes, sizeof(Inscricao));
+    
+    nova->participante = participante;
+    nova->evento = evento;
+    strncpy(nova->dataInscricao, dataInscricao, sizeof(nova->dataInscricao)-1);
+    nova->dataInscricao[sizeof(nova->dataInscricao)-1] = '\0';
+    nova->status = status;
+    nova->proxima = NULL;
+    nova->proxima_do_evento = NULL;
+    nova->proxima_do_participante = NULL;
+    nova->proxima_na_espera = NULL;
+    nova->senha = 0;
+    
+    return nova;
+}
+
+// Função para destruir uma inscrição
+void inscricao_destruir(Inscricao* inscricao) {
+    liberar_no(&slab_inscricoes, inscricao);
+}
+
+// Função para verificar se um participante já está inscrito em um evento
+bool inscricao_existe(ListaInscricoes* lista, int idParticipante, int idEvento) {
+    return indice_buscar(&lista->indice, indice_chave_inscricao(idParticipante, idEvento)) != NULL;
+}
+
+// Função para encadear uma inscrição no fim da lista global e da lista do seu evento
+void lista_inscricoes_encadear(ListaInscricoes* lista, TabelaEventos* eventos, Inscricao* nova) {
+    nova->proxima = NULL;
+    if (lista->inicio == NULL) {
+        lista->inicio = nova;
+    } else {
+        lista->fim->proxima = nova;
+    }
+    lista->fim = nova;
+    
+    nova->proxima_do_evento = NULL;
+    if (eventos->inscricoes_inicio[nova->evento] == NULL) {
+        eventos->inscricoes_inicio[nova->evento] = nova;
+    } else {
+        eventos->inscricoes_fim[nova->evento]->proxima_do_evento = nova;
+    }
+    eventos->inscricoes_fim[nova->evento] = nova;
+    lista->tamanho++;
+}
+
+// Função para encadear uma inscrição no fim da lista do seu participante
+void inscricao_encadear_no_participante(TabelaParticipantes* participantes, Inscricao* nova) {
+    Participante* participante = &participantes->registros[nova->participante];
+    nova->proxima_do_participante = NULL;
+    if (participante->inscricoes_inicio == NULL) {
+        participante->inscricoes_inicio = nova;
+    } else {
+        participante->inscricoes_fim->proxima_do_participante = nova;
+    }
+    participante->inscricoes_fim = nova;
+}
+
+// Função para contar as saídas da lista de espera com senha menor que a informada
+static int lista_espera_saidas_antes(const FilaEspera* fila, int senha) {
+    int total = 0;
+    for (int i = senha; i > 0; i -= i & -i) {
+        total += fila->saidas[i];
+    }
+    return total;
+}
+
+// Função para colocar uma inscrição pendente no fim da lista de espera do seu evento
+void lista_espera_entrar(TabelaEventos* eventos, Inscricao* inscricao) {
+    FilaEspera* fila = eventos->espera[inscricao->evento];
+    if (fila == NULL) {
+        fila = (FilaEspera*)alocar_memoria(sizeof(FilaEspera));
+        memset(fila, 0, sizeof(FilaEspera));
+        eventos->espera[inscricao->evento] = fila;
+    }
+    
+    // Árvore cheia: dobrar. Com tamanho potência de 2, os nós novos cobrem só senhas ainda não
+    // emitidas (zero), exceto o último, que cobre todas e recebe o total atual
+    if (fila->emitidas == fila->alocadas) {
+        int alocadas = fila->alocadas == 0 ? 64 : fila->alocadas * 2;
+        int* saidas = (int*)alocar_memoria(((size_t)alocadas + 1) * sizeof(int));
+        memset(saidas, 0, ((size_t)alocadas + 1) * sizeof(int));
+        if (fila->alocadas > 0) {
+            memcpy(saidas, fila->saidas, ((size_t)fila->alocadas + 1) * sizeof(int));
+            saidas[alocadas] = lista_espera_saidas_antes(fila, fila->alocadas);
+        }
+        liberar_memoria(fila->saidas);
+        fila->saidas = saidas;
+        fila->alocadas = alocadas;
+    }
+    
+    inscricao->senha = fila->emitidas++;
+    inscricao->proxima_na_espera = NULL;
+    if (fila->inicio == NULL) {
+        fila->inicio = inscricao;
+    } else {
+        fila->fim->proxima_na_espera = inscricao;
+    }
+    fila->fim = inscricao;
+    fila->aguardando++;
+}
+
+// Função para marcar a saída de uma inscrição da lista de espera (promovida ou cancelada);
+// quando a fila esvazia, as senhas recomeçam do zero
+static void lista_espera_sair(FilaEspera* fila, const Inscricao* inscricao) {
+    for (int i = inscricao->senha + 1; i <= fila->alocadas; i += i & -i) {
+        fila->saidas[i]++;
+    }
+    if (--fila->aguardando == 0) {
+        memset(fila->saidas, 0, ((size_t)fila->alocadas + 1) * sizeof(int));
+        fila->emitidas = 0;
+        fila->inicio = NULL;
+        fila->fim = NULL;
+    }
+}
+
+// Função para obter a posição de uma inscrição pendente na lista de espera (1 = a próxima a ser
+// promovida): quem chegou antes e ainda não saiu
+int lista_espera_posicao(const TabelaEventos* eventos, const Inscricao* inscricao) {
+    const FilaEspera* fila = eventos->espera[inscricao->evento];
+    return 1 + inscricao->senha - lista_espera_saidas_antes(fila, inscricao->senha);
+}
+
+// Função para obter quantas inscrições aguardam na lista de espera de um evento
+int lista_espera_tamanho(const TabelaEventos* eventos, int evento) {
+    return eventos->espera[evento] != NULL ? eventos->espera[evento]->aguardando : 0;
+}
+
+// Função para mudar o status de uma inscrição ativa, mantendo o índice, o contador de ativas, a
+// lista de espera e as alterações do próximo checkpoint (as vagas ficam a cargo de quem chama)
+void inscricao_mudar_status(ListaInscricoes* lista, TabelaEventos* eventos, const TabelaParticipantes* participantes,
+                            Inscricao* inscricao, StatusInscricao status) {
+    uint64_t chave = indice_chave_inscricao(participantes->registros[inscricao->participante].id,
+                                            eventos->id[inscricao->evento]);
+    if (inscricao->status == PENDENTE) {
+        lista_espera_sair(eventos->espera[inscricao->evento], inscricao);
+    }
+    inscricao->status = status;
+    if (status == CANCELADA) {
+        indice_remover(&lista->indice, chave);
+        lista->ativas--;
+    }
+    
+    // Registrar a mudança para o próximo checkpoint (a vaga ocupada ou devolvida altera o evento)
+    if (lista->quantidade_alteracoes == lista->alocadas_alteracoes) {
+        lista->alocadas_alteracoes = lista->alocadas_alteracoes == 0 ? 16 : lista->alocadas_alteracoes * 2;
+        lista->alteracoes = (AlteracaoInscricao*)coluna_redimensionar(lista->alteracoes,
+                                                                      (size_t)lista->alocadas_alteracoes,
+                                                                      sizeof(AlteracaoInscricao));
+    }
+    lista->alteracoes[lista->quantidade_alteracoes].chave = chave;
+    lista->alteracoes[lista->quantidade_alteracoes].status = status;
+    lista->quantidade_alteracoes++;
+    conjunto_ids_adicionar(&eventos->alterados, eventos->id[inscricao->evento]);
+}
+
+// Função para promover inscrições da lista de espera enquanto o evento tiver vagas, a partir da
+// cabeça (quem já saiu da fila é descartado ao chegar nela); devolve quantas foram promovidas.
+// Depois de uma redução de capacidade as vagas ficam negativas, e só há promoção quando as
+// confirmadas voltam a ficar abaixo da capacidade
+int lista_espera_promover(ListaInscricoes* lista, TabelaEventos* eventos, const TabelaParticipantes* participantes,
+                          int evento) {
+    FilaEspera* fila = eventos->espera[evento];
+    int promovidas = 0;
+    while (fila != NULL && fila->aguardando > 0 && eventos->vagasDisponiveis[evento] > 0) {
+        while (fila->inicio->status != PENDENTE) {
+            fila->inicio = fila->inicio->proxima_na_espera;
+        }
+        Inscricao* cabeca = fila->inicio;
+        fila->inicio = cabeca->proxima_na_espera;
+        inscricao_mudar_status(lista, eventos, participantes, cabeca, CONFIRMADA);
+        eventos_ajustar_vagas(eventos, evento, -1);
+        promovidas++;
+    }
+    return promovidas;
+}
+
+// Função para adicionar uma inscrição à lista
+void lista_inscricoes_adicionar(ListaInscricoes* lista, TabelaEventos* eventos, TabelaParticipantes* participantes,
+                                Inscricao* nova) {
+    // Encadear na lista global e nas listas do evento e do participante
+    lista_inscricoes_encadear(lista, eventos, nova);
+    inscricao_encadear_no_participante(participantes, nova);
+    
+    // Pendentes entram na lista de espera; apenas inscrições ativas entram no índice de duplicatas
+    if (nova->status == PENDENTE) {
+        lista_espera_entrar(eventos, nova);
+    }
+    if (nova->status != CANCELADA) {
+        indice_inserir(&lista->indice,
+                       indice_chave_inscricao(participantes->registros[nova->participante].id,
+                                              eventos->id[nova->evento]), nova);
+        lista->ativas++;
+    }
+}
+
+// Função para adicionar de uma vez, na ordem do vetor, inscrições já gravadas a estruturas ainda sem
+// inscrições (carga do snapshot). As listas de cada evento e participante são montadas de trás para
+// frente, pela cabeça: cada nó é visitado em sequência, sem voltar ao último nó de cada lista
+void lista_inscricoes_adicionar_em_lote(ListaInscricoes* lista, TabelaEventos* eventos,
+                                        TabelaParticipantes* participantes, Inscricao** novas, int quantidade) {
+    for (int k = quantidade - 1; k >= 0; k--) {
+        Inscricao* nova = novas[k];
+        nova->proxima = k + 1 < quantidade ? novas[k + 1] : NULL;
+
+        nova->proxima_do_evento = eventos->inscricoes_inicio[nova->evento];
+        if (nova->proxima_do_evento == NULL) {
+            eventos->inscricoes_fim[nova->evento] = nova;
+        }
+        eventos->inscricoes_inicio[nova->evento] = nova;
+
+        Participante* participante = &participantes->registros[nova->participante];
+        nova->proxima_do_participante = participante->inscricoes_inicio;
+        if (nova->proxima_do_participante == NULL) {
+            participante->inscricoes_fim = nova;
+        }
+        participante->inscricoes_inicio = nova;
+    }
+    if (quantidade > 0) {
+        lista->inicio = novas[0];
+        lista->fim = novas[quantidade - 1];
+    }
+    lista->tamanho += quantidade;
+
+    // Lista de espera e índice de duplicatas na ordem de cadastro, como em lista_inscricoes_adicionar
+    EntradaIndice* entradas = (EntradaIndice*)alocar_memoria(((size_t)quantidade + 1) * sizeof(EntradaIndice));
+    size_t ativas = 0;
+    for (int k = 0; k < quantidade; k++) {
+        Inscricao* nova = novas[k];
+        if (nova->status == PENDENTE) {
+            lista_espera_entrar(eventos, nova);
+        }
+        if (nova->status != CANCELADA) {
+            entradas[ativas].chave = indice_chave_inscricao(participantes->registros[nova->participante].id,
+                                                            eventos->id[nova->evento]);
+            entradas[ativas++].valor = nova;
+        }
+    }
+    indice_inserir_em_lote(&lista->indice, entradas, ativas);
+    lista->ativas += (int)ativas;
+    liberar_memoria(entradas);
+}
+
+// Função para inscrever um participante em um evento, ocupando uma vaga; com o evento lotado,
+// a inscrição fica pendente no fim da lista de espera
+Inscricao* lista_inscricoes_inscrever(ListaInscricoes* lista, TabelaEventos* eventos,
+                                      TabelaParticipantes* participantes, int participante, int evento,
+                                      const char* data) {
+    bool lotado = eventos->vagasDisponiveis[evento] <= 0;
+    Inscricao* nova = inscricao_criar(participante, evento, data, lotado ? PENDENTE : CONFIRMADA);
+    lista_inscricoes_adicionar(lista, eventos, participantes, nova);
+    if (!lotado) {
+        eventos_ajustar_vagas(eventos, evento, -1);
+        conjunto_ids_adicionar(&eventos->alterados, eventos->id[evento]);
+    }
+    return nova;
+}
+
+// Motivos de recusa de uma inscrição (inscricao_impedimento, motor_inscrever e importação); quem
+// precisa distinguir o motivo compara com estas constantes
+static const char MOTIVO_EVENTO_INEXISTENTE[] = "evento não encontrado";
+static const char MOTIVO_SEM_VAGAS[] = "não há vagas disponíveis para este evento";
+static const char MOTIVO_PARTICIPANTE_INEXISTENTE[] = "participante não encontrado";
+static const char MOTIVO_JA_INSCRITO[] = "este participante já está inscrito neste evento";
+
+// Função para verificar se uma inscrição pode ser feita (NULL se pode; senão, o motivo); com
+// aceitar_espera, evento lotado não impede: a inscrição vai para a lista de espera
+const char* inscricao_impedimento(const TabelaEventos* eventos, const TabelaParticipantes* participantes,
+                                  ListaInscricoes* lista, int evento, int participante, bool aceitar_espera) {
+    if (evento == -1) {
+        return MOTIVO_EVENTO_INEXISTENTE;
+    }
+    if (!aceitar_espera && eventos->vagasDisponiveis[evento] <= 0) {
+        return MOTIVO_SEM_VAGAS;
+    }
+    if (participante == -1) {
+        return MOTIVO_PARTICIPANTE_INEXISTENTE;
+    }
+    if (inscricao_existe(lista, participantes->registros[participante].id, eventos->id[evento])) {
+        return MOTIVO_JA_INSCRITO;
+    }
+    return NULL;
+}
+
+// Função para verificar se o evento e o participante de uma inscrição ainda existem (as de removidos
+// estão sempre canceladas e só aparecem até o próximo arquivamento)
+bool inscricao_referencias_vivas(const TabelaEventos* eventos, const TabelaParticipantes* participantes,
+                                 const Inscricao* inscricao) {
+    return eventos->ativo[inscricao->evento] && participantes->registros[inscricao->participante].ativo;
+}
+
+// Função para cancelar uma inscrição ativa, devolvendo a vaga de uma confirmada; com promover, a
+// vaga vai para a cabeça da lista de espera, se houver alguém esperando
+void inscricao_cancelar(ListaInscricoes* lista, TabelaEventos* eventos, const TabelaParticipantes* participantes,
+                        Inscricao* inscricao, bool promover) {
+    bool ocupava_vaga = inscricao->status == CONFIRMADA;
+    inscricao_mudar_status(lista, eventos, participantes, inscricao, CANCELADA);
+    if (ocupava_vaga) {
+        eventos_ajustar_vagas(eventos, inscricao->evento, 1);
+        if (promover) {
+            lista_espera_promover(lista, eventos, participantes, inscricao->evento);
+        }
+    }
+}
+
+// Função para cancelar uma inscrição confirmada ou pendente
+bool lista_inscricoes_cancelar(ListaInscricoes* lista, TabelaEventos* eventos, const TabelaParticipantes* participantes,
+                               int idParticipante, int idEvento) {
+    Inscricao* inscricao = (Inscricao*)indice_buscar(&lista->indice, indice_chave_inscricao(idParticipante, idEvento));
+    if (inscricao == NULL) {
+        return false;
+    }
+    inscricao_cancelar(lista, eventos, participantes, inscricao, true);
+    return true;
+}
+
+// Função para remover um evento cancelando antes as suas inscrições ativas, pela lista do próprio
+// evento (O(inscrições do evento)); as canceladas continuam apontando para a posição, que só é
+// reutilizada depois que forem arquivadas
+bool lista_inscricoes_remover_evento(ListaInscricoes* lista, TabelaEventos* eventos,
+                                     const TabelaParticipantes* participantes, int idEvento) {
+    int pos = eventos_buscar_por_id(eventos, idEvento);
+    if (pos == -1) {
+        return false;
+    }
+    for (Inscricao* atual = eventos->inscricoes_inicio[pos]; atual != NULL; atual = atual->proxima_do_evento) {
+        if (atual->status != CANCELADA) {
+            inscricao_cancelar(lista, eventos, participantes, atual, false);
+        }
+    }
+    eventos_remover(eventos, idEvento);
+    return true;
+}
+
+// Função para remover um participante cancelando antes as suas inscrições ativas, pela lista do
+// próprio participante (O(inscrições do participante)); cada vaga devolvida promove a lista de
+// espera do evento, se promover. A posição fica guardada até as canceladas serem arquivadas
+bool lista_inscricoes_remover_participante(ListaInscricoes* lista, TabelaEventos* eventos,
+                                           TabelaParticipantes* participantes, int idParticipante, bool promover) {
+    int participante = participantes_buscar_por_id(participantes, idParticipante);
+    if (participante == -1) {
+        return false;
+    }
+    for (Inscricao* atual = participantes->registros[participante].inscricoes_inicio; atual != NULL;
+         atual = atual->proxima_do_participante) {
+        if (atual->status != CANCELADA) {
+            inscricao_cancelar(lista, eventos, participantes, atual, promover);
+        }
+    }
+    participantes_remover(participantes, idParticipante);
+    return true;
+}
+
+// Função para listar inscrições por evento (percorre apenas as inscrições do evento)
+void lista_inscricoes_por_evento(TabelaEventos* eventos, const TabelaParticipantes* participantes, int idEvento) {
+    bool encontrado = false;
+    int pos = eventos_buscar_por_id(eventos, idEvento);
+    
+    printf("\n=== INSCRIÇÕES DO EVENTO ID %d ===\n", idEvento);
+    
+    Inscricao* atual = pos != -1 ? eventos->inscricoes_inicio[pos] : NULL;
+    while (atual != NULL) {
+        if (atual->status == CONFIRMADA) {
+            printf("Participante: %s (ID: %d)\n", 
+                   participantes_nome(participantes, atual->participante), 
+                   participantes->registros[atual->participante].id);
+            printf("Data de inscrição: %s\n", atual->dataInscricao);
+            printf("--------------------\n");
+            encontrado = true;
+        }
+        atual = atual->proxima_do_evento;
+    }
+    
+    if (!encontrado) {
+        printf("Nenhuma inscrição encontrada para este evento.\n");
+    }
+    if (pos != -1 && lista_espera_tamanho(eventos, pos) > 0) {
+        printf("Lista de espera: %d participante(s)\n", lista_espera_tamanho(eventos, pos));
+    }
+}
+
+// Função para listar inscrições por participante (percorre apenas as inscrições do participante)
+void lista_inscricoes_por_participante(TabelaParticipantes* participantes, TabelaEventos* eventos, int idParticipante) {
+    bool encontrado = false;
+    char data[11];
+    int participante = participantes_buscar_por_id(participantes, idParticipante);
+    
+    printf("\n=== INSCRIÇÕES DO PARTICIPANTE ID %d ===\n", idParticipante);
+    
+    Inscricao* atual = participante != -1 ? participantes->registros[participante].inscricoes_inicio : NULL;
+    while (atual != NULL) {
+        if (atual->status == CONFIRMADA) {
+            data_formatar(eventos->data[atual->evento], data);
+            printf("Evento: %s (ID: %d)\n", 
+                   eventos_nome(eventos, atual->evento), 
+                   eventos->id[atual->evento]);
+            printf("Data: %s\n", data);
+            printf("Data de inscrição: %s\n", atual->dataInscricao);
+            printf("--------------------\n");
+            encontrado = true;
+        } else if (atual->status == PENDENTE) {
+            printf("Evento: %s (ID: %d) - na lista de espera, posição %d\n",
+                   eventos_nome(eventos, atual->evento), eventos->id[atual->evento],
+                   lista_espera_posicao(eventos, atual));
+            printf("--------------------\n");
+            encontrado = true;
+        }
+        atual = atual->proxima_do_participante;
+    }
+    
+    if (!encontrado) {
+        printf("Nenhuma inscrição encontrada para este participante.\n");
+    }
+}
+
+// Função para obter quantas inscrições canceladas (lápides) ainda ocupam as listas
+int lista_inscricoes_canceladas(const ListaInscricoes* lista) {
+    return lista->tamanho - lista->ativas;
+}
+
+// Função para tirar as inscrições canceladas de uma lista encadeada pelo campo no deslocamento
+// informado, devolvendo o último nó mantido (o novo fim)
+static Inscricao* inscricoes_filtrar_canceladas(Inscricao** inicio, size_t deslocamento) {
+    Inscricao** elo = inicio;
+    Inscricao* ultima = NULL;
+    while (*elo != NULL) {
+        Inscricao** proximo = (Inscricao**)((char*)*elo + deslocamento);
+        if ((*elo)->status == CANCELADA) {
+            *elo = *proximo;
+        } else {
+            ultima = *elo;
+            elo = proximo;
+        }
+    }
+    return ultima;
+}
+
+// Função para descartar da memória as inscrições canceladas (já copiadas para o arquivo morto):
+// cada lista que as encadeia (global, dos eventos, dos participantes e de espera) é filtrada em
+// uma passada e só então os nós são liberados, junto com os eventos e participantes removidos que
+// eram mantidos por elas; devolve quantas foram descartadas
+int lista_inscricoes_descartar_canceladas(ListaInscricoes* lista, TabelaEventos* eventos,
+                                          TabelaParticipantes* participantes) {
+    for (int pos = eventos->inicio; pos != -1; pos = eventos->proximo[pos]) {
+        eventos->inscricoes_fim[pos] = inscricoes_filtrar_canceladas(&eventos->inscricoes_inicio[pos],
+                                                                     offsetof(Inscricao, proxima_do_evento));
+        // Quem saiu do meio da fila continua encadeado até chegar à cabeça: refazer a fila só com
+        // as pendentes (as senhas e a árvore de saídas não mudam)
+        FilaEspera* fila = eventos->espera[pos];
+        if (fila != NULL && fila->aguardando > 0) {
+            Inscricao** elo = &fila->inicio;
+            while (*elo != NULL) {
+                if ((*elo)->status != PENDENTE) {
+                    *elo = (*elo)->proxima_na_espera;
+                } else {
+                    fila->fim = *elo;
+                    elo = &(*elo)->proxima_na_espera;
+                }
+            }
+        }
+    }
+    for (int pos = 0; pos < participantes->usados; pos++) {
+        Participante* participante = &participantes->registros[pos];
+        if (participante->ativo) {
+            participante->inscricoes_fim = inscricoes_filtrar_canceladas(&participante->inscricoes_inicio,
+                                                                         offsetof(Inscricao, proxima_do_participante));
+        }
+    }
+    
+    // Lista global: a última inscrição já gravada passa a ser a última mantida até ela
+    int descartadas = 0;
+    bool antes_das_novas = lista->persistidas_ate != NULL;
+    Inscricao* persistidas_ate = NULL;
+    Inscricao** elo = &lista->inicio;
+    lista->fim = NULL;
+    while (*elo != NULL) {
+        Inscricao* atual = *elo;
+        bool ultima_gravada = atual == lista->persistidas_ate;
+        if (atual->status == CANCELADA) {
+            *elo = atual->proxima;
+            inscricao_destruir(atual);
+            descartadas++;
+        } else {
+            lista->fim = atual;
+            if (antes_das_novas) {
+                persistidas_ate = atual;
+            }
+            elo = &atual->proxima;
+        }
+        if (ultima_gravada) {
+            antes_das_novas = false;
+        }
+    }
+    lista->persistidas_ate = persistidas_ate;
+    
+    // Sem canceladas, nada mais aponta para os eventos e participantes removidos
+    eventos_liberar_removidos(eventos);
+    participantes_liberar_removidos(participantes);
+    
+    lista->tamanho -= descartadas;
+    lista->arquivadas += descartadas;
+    lista->bytes_recuperados += (size_t)descartadas * sizeof(Inscricao);
+    return descartadas;
+}
+
+// Função para destruir a lista de inscrições
+void lista_inscricoes_destruir(ListaInscricoes* lista) {
+#if USAR_ALOCADOR_SLAB
+    // Todas as inscrições vivem no mesmo slab: liberação em bloco
+    slab_liberar_tudo(&slab_inscricoes);
+#else
+    Inscricao* atual = lista->inicio;
+    Inscricao* proxima;
+    
+    while (atual != NULL) {
+        proxima = atual->proxima;
+        inscricao_destruir(atual);
+        atual = proxima;
+    }
+#endif
+    
+    indice_liberar(&lista->indice);
+    liberar_memoria(lista->alteracoes);
+    liberar_memoria(lista);
+}
+
+// ====== ALGORITMOS DE ORDENAÇÃO ======
+
+// Par (chave, posição) ordenado no lugar dos eventos
+typedef struct chave_ordenacao {
+    uint64_t chave; // Data compactada AAAAMMDD << 32 | ID do evento
+    int pos;        // Posição do evento na tabela
+} ChaveOrdenacao;
+
+#define RADIX_BITS 11
+#define RADIX_BALDES (1 << RADIX_BITS)
+#define RADIX_PASSADAS ((64 + RADIX_BITS - 1) / RADIX_BITS)
+
+// Radix sort LSD estável dos pares por chave (passadas de 11 bits; dígitos iguais são pulados).
+// Os histogramas de todos os dígitos saem de uma única leitura, e as passadas alternam entre os
+// dois vetores em vez de copiar o resultado de volta a cada passada
+void radix_sort_chaves(ChaveOrdenacao* pares, ChaveOrdenacao* auxiliar, int n) {
+    size_t* contagem = (size_t*)alocar_memoria(RADIX_PASSADAS * RADIX_BALDES * sizeof(size_t));
+    memset(contagem, 0, RADIX_PASSADAS * RADIX_BALDES * sizeof(size_t));
+    for (int i = 0; i < n; i++) {
+        uint64_t chave = pares[i].chave;
+        for (int d = 0; d < RADIX_PASSADAS; d++) {
+            contagem[d * RADIX_BALDES + ((chave >> (d * RADIX_BITS)) & (RADIX_BALDES - 1))]++;
+        }
+    }
+    
+    ChaveOrdenacao* origem = pares;
+    ChaveOrdenacao* destino = auxiliar;
+    for (int d = 0; d < RADIX_PASSADAS; d++) {
+        int deslocamento = d * RADIX_BITS;
+        size_t* baldes = contagem + d * RADIX_BALDES;
+        
+        // Passada desnecessária: todas as chaves têm o mesmo dígito (ou não há chaves)
+        if (n == 0 || baldes[(origem[0].chave >> deslocamento) & (RADIX_BALDES - 1)] == (size_t)n) {
+            continue;
+        }
+        
+        size_t soma = 0;
+        for (int b = 0; b < RADIX_BALDES; b++) {
+            size_t c = baldes[b];
+            baldes[b] = soma;
+            soma += c;
+        }
+        
+        for (int i = 0; i < n; i++) {
+            destino[baldes[(origem[i].chave >> deslocamento) & (RADIX_BALDES - 1)]++] = origem[i];
+        }
+        ChaveOrdenacao* troca = origem;
+        origem = destino;
+        destino = troca;
+    }
+    if (origem != pares) {
+        memcpy(pares, origem, (size_t)n * sizeof(ChaveOrdenacao));
+    }
+    
+    liberar_memoria(contagem);
+}
+
+// Função para ordenar eventos por data (empates pelo ID) e refazer o índice de datas
+void ordenar_eventos_por_data(TabelaEventos* tabela, int tamanho) {
+    if (tabela->inicio == -1) {
+        return;
+    }
+    
+    // Montar os pares (data e ID, posição) na ordem atual
+    ChaveOrdenacao* pares = (ChaveOrdenacao*)alocar_memoria(tamanho * sizeof(ChaveOrdenacao));
+    ChaveOrdenacao* auxiliar = (ChaveOrdenacao*)alocar_memoria(tamanho * sizeof(ChaveOrdenacao));
+    
+    int n = 0;
+    for (int pos = tabela->inicio; pos != -1 && n < tamanho; pos = tabela->proximo[pos]) {
+        pares[n].chave = eventos_chave_data(tabela, pos);
+        pares[n].pos = pos;
+        n++;
+    }
+    
+    radix_sort_chaves(pares, auxiliar, n);
+    
+    // Reencadear a ordem de exibição sem mover os dados dos eventos
+    for (int k = 0; k < n; k++) {
+        tabela->anterior[pares[k].pos] = k > 0 ? pares[k - 1].pos : -1;
+        tabela->proximo[pares[k].pos] = k + 1 < n ? pares[k + 1].pos : -1;
+    }
+    tabela->inicio = pares[0].pos;
+    tabela->fim = pares[n - 1].pos;
+    
+    // Reconstruir a skip list em O(n) a partir da ordem obtida (reaproveita o auxiliar)
+    uint64_t* chaves = (uint64_t*)auxiliar;
+    int* posicoes = (int*)alocar_memoria(n * sizeof(int));
+    for (int k = 0; k < n; k++) {
+        chaves[k] = pares[k].chave;
+        posicoes[k] = pares[k].pos;
+    }
+    indice_datas_construir(&tabela->datas, chaves, posicoes, n);
+    
+    liberar_memoria(posicoes);
+    liberar_memoria(auxiliar);
+    liberar_memoria(pares);
+}
+
+// ====== FUNÇÕES DE UTILIDADE ======
+
 // Função para obter a data atual no formato YYYY-MM-DD
 void obter_data_atual(char* data_str) {
     time_t t = time(NULL);
     struct tm* tm_info = localtime(&t);
     
-    strftime(data_str, 11, "%Y-%m-%d", tm_info);
+    strftime(data_str, 11, "%Y-%m-%d", tm_info);
+}
+
+// Função para contar eventos na lista
+int contar_eventos(TabelaEventos* lista) {
+    return lista->tamanho;
+}
+
+// Marcador gravado nos arquivos binários para detectar a ordem de bytes de quem os gravou
+#define ORDEM_BYTES 0x01020304u
+
+// Função para calcular uma soma de verificação (FNV-1a sobre palavras de 64 bits, com a última
+// palavra completada por zeros, exatamente como uma seção alinhada a 8 bytes fica no arquivo)
+uint64_t soma_verificacao(const void* dados, size_t bytes) {
+    const char* p = (const char*)dados;
+    uint64_t soma = 1469598103934665603ULL;
+    size_t i = 0;
+    for (; i + 8 <= bytes; i += 8) {
+        uint64_t palavra;
+        memcpy(&palavra, p + i, 8);
+        soma = (soma ^ palavra) * 1099511628211ULL;
+    }
+    if (i < bytes) {
+        uint64_t palavra = 0;
+        memcpy(&palavra, p + i, bytes - i);
+        soma = (soma ^ palavra) * 1099511628211ULL;
+    }
+    return soma ^ bytes;
+}
+
+// Função para forçar a gravação em disco do conteúdo já entregue a um arquivo
+bool arquivo_sincronizar(FILE* arquivo) {
+    if (fflush(arquivo) != 0) {
+        return false;
+    }
+#ifdef _WIN32
+    return _commit(_fileno(arquivo)) == 0;
+#else
+    return fsync(fileno(arquivo)) == 0;
+#endif
+}
+
+// Função para obter um relógio monotônico em milissegundos
+double relogio_ms() {
+#ifdef _WIN32
+    return (double)GetTickCount64();
+#else
+    struct timespec agora;
+    clock_gettime(CLOCK_MONOTONIC, &agora);
+    return (double)agora.tv_sec * 1000.0 + (double)agora.tv_nsec / 1e6;
+#endif
+}
+
+// ====== TAREFAS PARALELAS ======
+
+// Quantidade de tarefas usadas na carga dos CSVs (0: uma por processador; --tarefas=N)
+static int tarefas_configuradas = 0;
+
+#ifdef _WIN32
+typedef HANDLE Tarefa;
+typedef CRITICAL_SECTION Trava;
+#else
+typedef pthread_t Tarefa;
+typedef pthread_mutex_t Trava;
+#endif
+
+typedef void (*FuncaoTarefa)(void* argumento);
+
+// Função e argumento entregues a uma nova tarefa
+typedef struct chamada_tarefa {
+    FuncaoTarefa funcao;
+    void* argumento;
+} ChamadaTarefa;
+
+// Ponto de entrada de toda tarefa: adapta a assinatura exigida pelo sistema
+#ifdef _WIN32
+static DWORD WINAPI tarefa_executar(LPVOID dados) {
+#else
+static void* tarefa_executar(void* dados) {
+#endif
+    ChamadaTarefa chamada = *(ChamadaTarefa*)dados;
+    liberar_memoria(dados);
+    chamada.funcao(chamada.argumento);
+    return 0;
+}
+
+// Função para iniciar uma tarefa (false se o sistema recusar)
+bool tarefa_iniciar(Tarefa* tarefa, FuncaoTarefa funcao, void* argumento) {
+    ChamadaTarefa* chamada = (ChamadaTarefa*)alocar_memoria(sizeof(ChamadaTarefa));
+    chamada->funcao = funcao;
+    chamada->argumento = argumento;
+#ifdef _WIN32
+    *tarefa = CreateThread(NULL, 0, tarefa_executar, chamada, 0, NULL);
+    if (*tarefa != NULL) {
+        return true;
+    }
+#else
+    if (pthread_create(tarefa, NULL, tarefa_executar, chamada) == 0) {
+        return true;
+    }
+#endif
+    liberar_memoria(chamada);
+    return false;
+}
+
+// Função para esperar o término de uma tarefa
+void tarefa_aguardar(Tarefa tarefa) {
+#ifdef _WIN32
+    WaitForSingleObject(tarefa, INFINITE);
+    CloseHandle(tarefa);
+#else
+    pthread_join(tarefa, NULL);
+#endif
+}
+
+// Funções de exclusão mútua
+void trava_iniciar(Trava* trava) {
+#ifdef _WIN32
+    InitializeCriticalSection(trava);
+#else
+    pthread_mutex_init(trava, NULL);
+#endif
+}
+
+void travar(Trava* trava) {
+#ifdef _WIN32
+    EnterCriticalSection(trava);
+#else
+    pthread_mutex_lock(trava);
+#endif
+}
+
+void destravar(Trava* trava) {
+#ifdef _WIN32
+    LeaveCriticalSection(trava);
+#else
+    pthread_mutex_unlock(trava);
+#endif
+}
+
+void trava_destruir(Trava* trava) {
+#ifdef _WIN32
+    DeleteCriticalSection(trava);
+#else
+    pthread_mutex_destroy(trava);
+#endif
+}
+
+// Função para ler um inteiro disputado por várias tarefas
+int atomico_ler(int* valor) {
+#ifdef _WIN32
+    return (int)InterlockedCompareExchange((volatile LONG*)valor, 0, 0);
+#else
+    return __atomic_load_n(valor, __ATOMIC_ACQUIRE);
+#endif
+}
+
+// Função para trocar um inteiro disputado se ele ainda tiver o valor esperado (compare-and-swap)
+bool atomico_trocar(int* valor, int esperado, int novo) {
+#ifdef _WIN32
+    return InterlockedCompareExchange((volatile LONG*)valor, (LONG)novo, (LONG)esperado) == (LONG)esperado;
+#else
+    return __atomic_compare_exchange_n(valor, &esperado, novo, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+}
+
+// Função para obter a quantidade de processadores disponíveis
+int processadores_disponiveis() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long processadores = sysconf(_SC_NPROCESSORS_ONLN);
+    return processadores > 0 ? (int)processadores : 1;
+#endif
+}
+
+// Grupo de tarefas que dividem uma lista de trabalhos: cada tarefa retira o próximo trabalho
+// ainda não iniciado, de modo que trabalhos demorados não deixam as demais paradas
+typedef struct grupo_tarefas {
+    FuncaoTarefa funcao;
+    void** trabalhos;
+    int quantidade;
+    int proximo;             // Próximo trabalho a ser retirado (protegido pela trava)
+    Trava trava;
+} GrupoTarefas;
+
+// Laço de cada tarefa do grupo
+static void grupo_tarefas_trabalhar(void* argumento) {
+    GrupoTarefas* grupo = (GrupoTarefas*)argumento;
+    for (;;) {
+        travar(&grupo->trava);
+        int trabalho = grupo->proximo++;
+        destravar(&grupo->trava);
+        if (trabalho >= grupo->quantidade) {
+            return;
+        }
+        grupo->funcao(grupo->trabalhos[trabalho]);
+    }
+}
+
+// Função para executar a função sobre cada trabalho com até `tarefas` tarefas simultâneas
+// (a tarefa que chama também trabalha; retorna quando todos os trabalhos terminarem)
+void executar_em_paralelo(FuncaoTarefa funcao, void** trabalhos, int quantidade, int tarefas) {
+    if (tarefas > quantidade) {
+        tarefas = quantidade;
+    }
+    if (tarefas <= 1) {
+        for (int k = 0; k < quantidade; k++) {
+            funcao(trabalhos[k]);
+        }
+        return;
+    }
+    
+    GrupoTarefas grupo;
+    grupo.funcao = funcao;
+    grupo.trabalhos = trabalhos;
+    grupo.quantidade = quantidade;
+    grupo.proximo = 0;
+    trava_iniciar(&grupo.trava);
+    
+    // Se o sistema recusar alguma tarefa, as que existem dão conta dos trabalhos
+    Tarefa* auxiliares = (Tarefa*)alocar_memoria((size_t)(tarefas - 1) * sizeof(Tarefa));
+    int iniciadas = 0;
+    for (int t = 1; t < tarefas; t++) {
+        if (tarefa_iniciar(&auxiliares[iniciadas], grupo_tarefas_trabalhar, &grupo)) {
+            iniciadas++;
+        }
+    }
+    grupo_tarefas_trabalhar(&grupo);
+    for (int t = 0; t < iniciadas; t++) {
+        tarefa_aguardar(auxiliares[t]);
+    }
+    
+    liberar_memoria(auxiliares);
+    trava_destruir(&grupo.trava);
+}
+
+// ====== LOG DE OPERAÇÕES (WAL) ======
+
+#define ARQUIVO_LOG "dados.wal"
+#define LOG_VERSAO 1
+#define LOG_GRUPO_REGISTROS 64   // Registros por grupo antes de forçar a confirmação
+#define LOG_GRUPO_MS 20.0        // Idade máxima do registro mais antigo de um grupo
+#define LOG_GRUPO_LOTE 16384     // Registros por grupo no modo em lote (a idade máxima continua valendo)
+#define LOG_GRUPO_RELOGIO 16     // Registros entre consultas ao relógio dentro de um grupo
+#define LOG_BUFFER_INICIAL 4096
+
+// Política de sincronização do log com o disco
+typedef enum {
+    LOG_SINCRONIZAR_SEMPRE,   // fsync a cada operação
+    LOG_SINCRONIZAR_EM_GRUPO, // fsync por grupo de operações (padrão)
+    LOG_SINCRONIZAR_NUNCA     // Apenas entrega ao sistema operacional
+} PoliticaSincronizacao;
+
+// Operações registradas no log (o conteúdo de cada registro começa pelo tipo)
+typedef enum {
+    OP_EVENTO_CRIAR = 1,
+    OP_EVENTO_ALTERAR,
+    OP_EVENTO_REMOVER,
+    OP_PARTICIPANTE_CRIAR,
+    OP_PARTICIPANTE_ALTERAR,
+    OP_PARTICIPANTE_REMOVER,
+    OP_INSCRICAO_CRIAR,
+    OP_INSCRICAO_CANCELAR
+} TipoOperacao;
+
+// Cabeçalho do arquivo de log
+typedef struct cabecalho_log {
+    char magica[8];          // "EVWAL"
+    uint32_t versao;
+    uint32_t ordem_bytes;    // ORDEM_BYTES
+    uint64_t lsn_base;       // Número de sequência do checkpoint que criou o log
+    uint64_t soma;           // Soma dos campos anteriores
+} CabecalhoLog;
+
+// Cabeçalho de cada registro; a soma cobre o LSN e o conteúdo
+typedef struct cabecalho_registro_log {
+    uint32_t tamanho;        // Bytes do conteúdo
+    uint32_t soma;
+    uint64_t lsn;            // Número de sequência (estritamente crescente)
+} CabecalhoRegistroLog;
+
+// Buffer de bytes que cresce sob demanda (registros do log e conteúdo dos segmentos)
+typedef struct buffer_bytes {
+    char* dados;
+    size_t usados;
+    size_t alocados;
+} BufferBytes;
+
+// Leitor sequencial dos campos gravados em um BufferBytes
+typedef struct leitor_bytes {
+    char* atual;
+    char* fim;
+    bool erro;               // Conteúdo mais curto que o esperado
+} LeitorBytes;
+
+// Função para acrescentar bytes ao buffer
+void buffer_acrescentar(BufferBytes* buffer, const void* dados, size_t tamanho) {
+    if (buffer->usados + tamanho > buffer->alocados) {
+        size_t alocados = buffer->alocados == 0 ? LOG_BUFFER_INICIAL : buffer->alocados * 2;
+        while (buffer->usados + tamanho > alocados) {
+            alocados *= 2;
+        }
+        char* novo = (char*)alocar_memoria(alocados);
+        if (buffer->usados > 0) {
+            memcpy(novo, buffer->dados, buffer->usados);
+        }
+        liberar_memoria(buffer->dados);
+        buffer->dados = novo;
+        buffer->alocados = alocados;
+    }
+    memcpy(buffer->dados + buffer->usados, dados, tamanho);
+    buffer->usados += tamanho;
+}
+
+// Função para acrescentar um inteiro de 32 bits
+void buffer_inteiro(BufferBytes* buffer, int32_t valor) {
+    buffer_acrescentar(buffer, &valor, sizeof(valor));
+}
+
+// Função para acrescentar um texto (comprimento de 16 bits seguido dos bytes, sem '\0')
+void buffer_texto(BufferBytes* buffer, const char* texto) {
+    size_t comprimento = strlen(texto);
+    uint16_t curto = (uint16_t)(comprimento > UINT16_MAX ? UINT16_MAX : comprimento);
+    buffer_acrescentar(buffer, &curto, sizeof(curto));
+    buffer_acrescentar(buffer, texto, curto);
+}
+
+// Função para ler um inteiro de 32 bits
+int32_t leitor_inteiro(LeitorBytes* leitor) {
+    int32_t valor = 0;
+    if (leitor->fim - leitor->atual < (ptrdiff_t)sizeof(valor)) {
+        leitor->erro = true;
+        return 0;
+    }
+    memcpy(&valor, leitor->atual, sizeof(valor));
+    leitor->atual += sizeof(valor);
+    return valor;
+}
+
+// Função para ler um texto, terminando-o com '\0' no próprio conteúdo
+// (os bytes são deslocados sobre o comprimento, que já foi lido)
+const char* leitor_texto(LeitorBytes* leitor) {
+    uint16_t comprimento;
+    if (leitor->fim - leitor->atual < (ptrdiff_t)sizeof(comprimento)) {
+        leitor->erro = true;
+        return "";
+    }
+    memcpy(&comprimento, leitor->atual, sizeof(comprimento));
+    if (leitor->fim - leitor->atual - (ptrdiff_t)sizeof(comprimento) < (ptrdiff_t)comprimento) {
+        leitor->erro = true;
+        return "";
+    }
+    char* texto = leitor->atual;
+    memmove(texto, texto + sizeof(comprimento), comprimento);
+    texto[comprimento] = '\0';
+    leitor->atual += sizeof(comprimento) + comprimento;
+    return texto;
+}
+
+// Log de operações: registros são acumulados em um buffer e confirmados em grupo
+// (uma escrita e um fsync para vários registros)
+typedef struct log_operacoes {
+    FILE* arquivo;           // Aberto para acréscimo
+    const char* caminho;
+    BufferBytes registros;   // Registros ainda não confirmados
+    size_t inicio_registro;  // Deslocamento do registro em construção
+    int pendentes;
+    int registros_por_grupo;
+    double inicio_grupo;     // Instante do registro mais antigo do grupo (ms)
+    uint64_t ultimo_lsn;
+    PoliticaSincronizacao politica;
+    bool falhou;
+    char* conteudo;          // Arquivo lido na abertura, até ser reaplicado
+    size_t tamanho_conteudo;
+} LogOperacoes;
+
+// Função para iniciar um registro do tipo indicado
+static void log_iniciar_registro(LogOperacoes* log, TipoOperacao tipo) {
+    CabecalhoRegistroLog vazio = { 0, 0, 0 };
+    uint8_t codigo = (uint8_t)tipo;
+    log->inicio_registro = log->registros.usados;
+    buffer_acrescentar(&log->registros, &vazio, sizeof(vazio));
+    buffer_acrescentar(&log->registros, &codigo, sizeof(codigo));
+}
+
+// Função para gravar os registros pendentes e, conforme a política, sincronizá-los com o disco
+void log_confirmar(LogOperacoes* log) {
+    if (log->registros.usados == 0) {
+        return;
+    }
+    if (!log->falhou) {
+        bool ok = fwrite(log->registros.dados, 1, log->registros.usados, log->arquivo) == log->registros.usados;
+        if (ok) {
+            ok = log->politica == LOG_SINCRONIZAR_NUNCA ? fflush(log->arquivo) == 0
+                                                        : arquivo_sincronizar(log->arquivo);
+        }
+        if (!ok) {
+            // As alterações continuam em memória e serão salvas no checkpoint de saída
+            fprintf(stderr, "Erro ao gravar %s: o log foi desativado até o próximo checkpoint\n", log->caminho);
+            log->falhou = true;
+        }
+    }
+    log->registros.usados = 0;
+    log->pendentes = 0;
+}
+
+// Função para fechar o registro em construção e aplicar a política de sincronização
+static void log_concluir_registro(LogOperacoes* log) {
+    CabecalhoRegistroLog cabecalho;
+    cabecalho.tamanho = (uint32_t)(log->registros.usados - log->inicio_registro - sizeof(cabecalho));
+    cabecalho.lsn = ++log->ultimo_lsn;
+    memcpy(log->registros.dados + log->inicio_registro, &cabecalho, sizeof(cabecalho));
+    cabecalho.soma = (uint32_t)soma_verificacao(log->registros.dados + log->inicio_registro + offsetof(CabecalhoRegistroLog, lsn),
+                                                sizeof(cabecalho.lsn) + cabecalho.tamanho);
+    memcpy(log->registros.dados + log->inicio_registro, &cabecalho, sizeof(cabecalho));
+    
+    // O relógio é lido no primeiro registro do grupo e depois a cada LOG_GRUPO_RELOGIO registros
+    if (log->pendentes++ == 0) {
+        log->inicio_grupo = relogio_ms();
+    }
+    if (log->politica == LOG_SINCRONIZAR_SEMPRE || log->pendentes >= log->registros_por_grupo ||
+        (log->pendentes % LOG_GRUPO_RELOGIO == 0 && relogio_ms() - log->inicio_grupo >= LOG_GRUPO_MS)) {
+        log_confirmar(log);
+    }
+}
+
+// Função para registrar a criação ou a alteração de um evento (estado completo após a operação)
+void log_registrar_evento(LogOperacoes* log, TipoOperacao tipo, const TabelaEventos* eventos, int pos) {
+    log_iniciar_registro(log, tipo);
+    buffer_inteiro(&log->registros, eventos->id[pos]);
+    buffer_texto(&log->registros, eventos_nome(eventos, pos));
+    buffer_texto(&log->registros, eventos_descricao(eventos, pos));
+    buffer_texto(&log->registros, eventos_categoria(eventos, pos));
+    buffer_inteiro(&log->registros, (int32_t)eventos->data[pos]);
+    buffer_inteiro(&log->registros, eventos->capacidade[pos]);
+    log_concluir_registro(log);
+}
+
+// Função para registrar a criação ou a alteração de um participante
+void log_registrar_participante(LogOperacoes* log, TipoOperacao tipo, const TabelaParticipantes* participantes,
+                                int pos) {
+    log_iniciar_registro(log, tipo);
+    buffer_inteiro(&log->registros, participantes->registros[pos].id);
+    buffer_texto(&log->registros, participantes_nome(participantes, pos));
+    buffer_texto(&log->registros, participantes_email(participantes, pos));
+    buffer_texto(&log->registros, participantes_telefone(participantes, pos));
+    log_concluir_registro(log);
+}
+
+// Função para registrar uma operação identificada apenas por IDs
+// (remoção de evento ou participante: um ID; cancelamento de inscrição: participante e evento)
+void log_registrar_ids(LogOperacoes* log, TipoOperacao tipo, int id, int outro_id) {
+    log_iniciar_registro(log, tipo);
+    buffer_inteiro(&log->registros, id);
+    if (tipo == OP_INSCRICAO_CANCELAR) {
+        buffer_inteiro(&log->registros, outro_id);
+    }
+    log_concluir_registro(log);
+}
+
+// Função para registrar uma nova inscrição
+void log_registrar_inscricao(LogOperacoes* log, const TabelaEventos* eventos, const TabelaParticipantes* participantes,
+                             const Inscricao* inscricao) {
+    log_iniciar_registro(log, OP_INSCRICAO_CRIAR);
+    buffer_inteiro(&log->registros, participantes->registros[inscricao->participante].id);
+    buffer_inteiro(&log->registros, eventos->id[inscricao->evento]);
+    buffer_inteiro(&log->registros, (int32_t)data_compactar_estrita(inscricao->dataInscricao, strlen(inscricao->dataInscricao)));
+    log_concluir_registro(log);
+}
+
+// ====== INSCRIÇÕES CONCORRENTES ======
+
+// Várias tarefas podem inscrever ao mesmo tempo (abertura de inscrições de um evento disputado)
+// durante uma sessão do motor: a vaga é ocupada com compare-and-swap no contador do próprio
+// evento, e os pares (participante, evento) aceitos na sessão ficam em faixas escolhidas pelo
+// participante, cada uma com sua trava, de modo que um evento disputado não concentra a espera
+// em uma única trava. As inscrições aceitas vão para a fila da tarefa que as aceitou e só entram
+// nas listas, no índice e no log na publicação, feita por uma única tarefa. Durante a sessão os
+// índices de eventos, participantes e inscrições são apenas consultados.
+
+#define MOTOR_FAIXAS 64
+
+// Faixa de pares aceitos na sessão (a folga afasta as travas vizinhas da mesma linha de cache)
+typedef struct faixa_inscricoes {
+    Trava trava;
+    IndiceHash pares;
+    char folga[64];
+} FaixaInscricoes;
+
+// Inscrição aceita, à espera da publicação
+typedef struct inscricao_aceita {
+    int participante;
+    int evento;
+} InscricaoAceita;
+
+// Fila de inscrições aceitas por uma tarefa (cada tarefa usa a sua, sem travas)
+typedef struct fila_aceitas {
+    InscricaoAceita* itens;
+    int quantidade;
+    int alocados;
+} FilaAceitas;
+
+typedef struct motor_inscricoes {
+    TabelaEventos* eventos;
+    TabelaParticipantes* participantes;
+    ListaInscricoes* inscricoes;
+    char data[11];           // Data das inscrições da sessão
+    FaixaInscricoes faixas[MOTOR_FAIXAS];
+} MotorInscricoes;
+
+// Função para iniciar uma sessão de inscrições concorrentes
+void motor_iniciar(MotorInscricoes* motor, TabelaEventos* eventos, TabelaParticipantes* participantes,
+                   ListaInscricoes* inscricoes, const char* data) {
+    motor->eventos = eventos;
+    motor->participantes = participantes;
+    motor->inscricoes = inscricoes;
+    snprintf(motor->data, sizeof(motor->data), "%s", data);
+    for (int f = 0; f < MOTOR_FAIXAS; f++) {
+        trava_iniciar(&motor->faixas[f].trava);
+        indice_iniciar(&motor->faixas[f].pares);
+    }
+}
+
+// Função para encerrar a sessão (as inscrições aceitas devem ter sido publicadas)
+void motor_liberar(MotorInscricoes* motor) {
+    for (int f = 0; f < MOTOR_FAIXAS; f++) {
+        trava_destruir(&motor->faixas[f].trava);
+        indice_liberar(&motor->faixas[f].pares);
+    }
+}
+
+// Função para ocupar uma vaga do evento (false se não houver): só a tarefa cuja troca vence
+// fica com a vaga, então o contador nunca passa de zero para baixo
+static bool motor_ocupar_vaga(TabelaEventos* eventos, int evento) {
+    int* vagas = &eventos->vagasDisponiveis[evento];
+    int atual = atomico_ler(vagas);
+    while (atual > 0) {
+        if (atomico_trocar(vagas, atual, atual - 1)) {
+            return true;
+        }
+        atual = atomico_ler(vagas);
+    }
+    return false;
+}
+
+// Função para tentar uma inscrição a partir de qualquer tarefa (NULL se aceita; senão, o motivo,
+// com as mesmas verificações e na mesma ordem de inscricao_impedimento)
+const char* motor_inscrever(MotorInscricoes* motor, FilaAceitas* fila, int idParticipante, int idEvento) {
+    TabelaEventos* eventos = motor->eventos;
+    int evento = eventos_buscar_por_id(eventos, idEvento);
+    if (evento == -1) {
+        return MOTIVO_EVENTO_INEXISTENTE;
+    }
+    if (atomico_ler(&eventos->vagasDisponiveis[evento]) <= 0) {
+        return MOTIVO_SEM_VAGAS;
+    }
+    int participante = participantes_buscar_por_id(motor->participantes, idParticipante);
+    if (participante == -1) {
+        return MOTIVO_PARTICIPANTE_INEXISTENTE;
+    }
+    uint64_t chave = indice_chave_inscricao(idParticipante, idEvento);
+    if (indice_buscar(&motor->inscricoes->indice, chave) != NULL) {
+        return MOTIVO_JA_INSCRITO;
+    }
+    
+    // O par é reservado antes da vaga: duas tentativas iguais não ocupam duas vagas
+    FaixaInscricoes* faixa = &motor->faixas[(uint32_t)idParticipante % MOTOR_FAIXAS];
+    travar(&faixa->trava);
+    bool repetida = indice_buscar(&faixa->pares, chave) != NULL;
+    if (!repetida) {
+        indice_inserir_posicao(&faixa->pares, chave, participante);
+    }
+    destravar(&faixa->trava);
+    if (repetida) {
+        return MOTIVO_JA_INSCRITO;
+    }
+    
+    if (!motor_ocupar_vaga(eventos, evento)) {
+        travar(&faixa->trava);
+        indice_remover(&faixa->pares, chave);
+        destravar(&faixa->trava);
+        return MOTIVO_SEM_VAGAS;
+    }
+    
+    if (fila->quantidade == fila->alocados) {
+        fila->alocados = fila->alocados == 0 ? 1024 : fila->alocados * 2;
+        fila->itens = (InscricaoAceita*)coluna_redimensionar(fila->itens, (size_t)fila->alocados,
+                                                            sizeof(InscricaoAceita));
+    }
+    fila->itens[fila->quantidade].participante = participante;
+    fila->itens[fila->quantidade].evento = evento;
+    fila->quantidade++;
+    return NULL;
+}
+
+// Função para publicar as inscrições aceitas, fila por fila, depois que todas as tarefas da sessão
+// terminaram (as vagas já foram ocupadas; aqui só se acerta o total da categoria). As filas são
+// esvaziadas e a sessão pode continuar; devolve quantas inscrições foram publicadas
+int motor_publicar(MotorInscricoes* motor, FilaAceitas* filas, int quantidade, LogOperacoes* log) {
+    TabelaEventos* eventos = motor->eventos;
+    int publicadas = 0;
+    for (int t = 0; t < quantidade; t++) {
+        for (int k = 0; k < filas[t].quantidade; k++) {
+            InscricaoAceita* aceita = &filas[t].itens[k];
+            // Os pares publicados passam a estar no índice de inscrições: a faixa do par é limpa (só as
+            // faixas usadas, que numa publicação por inscrição, no menu e no modo em lote, são uma)
+            FaixaInscricoes* faixa =
+                &motor->faixas[(uint32_t)motor->participantes->registros[aceita->participante].id % MOTOR_FAIXAS];
+            if (faixa->pares.tamanho > 0) {
+                indice_limpar(&faixa->pares);
+            }
+            Inscricao* nova = inscricao_criar(aceita->participante, aceita->evento, motor->data, CONFIRMADA);
+            lista_inscricoes_adicionar(motor->inscricoes, eventos, motor->participantes, nova);
+            eventos_ajustar_vagas_categoria(eventos, aceita->evento, -1);
+            conjunto_ids_adicionar(&eventos->alterados, eventos->id[aceita->evento]);
+            if (log != NULL) {
+                log_registrar_inscricao(log, eventos, motor->participantes, nova);
+            }
+        }
+        publicadas += filas[t].quantidade;
+        filas[t].quantidade = 0;
+    }
+    return publicadas;
+}
+
+// Função para inscrever pelo motor a partir de uma única tarefa (menu e modo em lote): a inscrição
+// aceita é publicada na hora, para que o comando seguinte já a encontre no índice e no log; devolve
+// a inscrição criada ou NULL, com o motivo em *motivo
+Inscricao* motor_inscrever_agora(MotorInscricoes* motor, FilaAceitas* fila, int idParticipante, int idEvento,
+                                 LogOperacoes* log, const char** motivo) {
+    *motivo = motor_inscrever(motor, fila, idParticipante, idEvento);
+    if (*motivo != NULL) {
+        return NULL;
+    }
+    motor_publicar(motor, fila, 1, log);
+    return motor->inscricoes->fim; // A publicação acrescenta no fim da lista global
+}
+
+// Trabalho de uma tarefa do teste de estresse: tentativas k = primeira, primeira + passo, ...
+typedef struct trabalho_estresse {
+    MotorInscricoes* motor;
+    FilaAceitas fila;
+    int primeira;
+    int passo;
+    int tentativas;
+    int participantes;
+    int idEvento;
+    int sem_vaga;
+    int repetidas;
+} TrabalhoEstresse;
+
+static void estresse_trabalhar(void* argumento) {
+    TrabalhoEstresse* trabalho = (TrabalhoEstresse*)argumento;
+    for (int k = trabalho->primeira; k < trabalho->tentativas; k += trabalho->passo) {
+        // Cada participante tenta duas vezes seguidas, que caem em tarefas diferentes e disputam entre si
+        int idParticipante = 1 + (int)((int64_t)(k / 2) * 7919 % trabalho->participantes);
+        const char* motivo = motor_inscrever(trabalho->motor, &trabalho->fila, idParticipante, trabalho->idEvento);
+        if (motivo != NULL) {
+            if (motivo == MOTIVO_SEM_VAGAS) {
+                trabalho->sem_vaga++;
+            } else {
+                trabalho->repetidas++;
+            }
+        }
+    }
+}
+
+// Função para medir inscrições por segundo em um único evento disputado, de 1 até o máximo de
+// tarefas (dobrando a cada rodada), conferindo que nenhuma vaga é vendida além da capacidade
+// e que nenhum participante fica inscrito duas vezes
+bool estresse_inscricoes(int maximo_tarefas) {
+    const int participantes = 300000;   // Primo com 7919: cada um aparece exatamente duas vezes
+    const int tentativas = 2 * participantes;
+    const int capacidade = 200000;
+    bool correto = true;
+    
+    printf("tarefas,tentativas_por_s,aceitas,sem_vaga,repetidas,vagas_restantes,sobrevenda\n");
+    for (int tarefas = 1; tarefas <= maximo_tarefas; tarefas *= 2) {
+        TabelaEventos* eventos = tabela_eventos_criar();
+        TabelaParticipantes* lista_participantes = tabela_participantes_criar();
+        ListaInscricoes* inscricoes = lista_inscricoes_criar();
+        eventos_adicionar_no_fim(eventos, 1, "Abertura", "Evento disputado", "Estresse", data_compactar("2030-01-01"),
+                                 capacidade);
+        participantes_reservar(lista_participantes, (size_t)participantes);
+        for (int id = 1; id <= participantes; id++) {
+            participantes_adicionar(lista_participantes, id, "Participante", "p@x", "0");
+        }
+        
+        MotorInscricoes* motor = (MotorInscricoes*)alocar_memoria(sizeof(MotorInscricoes));
+        motor_iniciar(motor, eventos, lista_participantes, inscricoes, "2030-01-01");
+        TrabalhoEstresse* trabalhos = (TrabalhoEstresse*)alocar_memoria((size_t)tarefas * sizeof(TrabalhoEstresse));
+        void** ponteiros = (void**)alocar_memoria((size_t)tarefas * sizeof(void*));
+        for (int t = 0; t < tarefas; t++) {
+            memset(&trabalhos[t], 0, sizeof(TrabalhoEstresse));
+            trabalhos[t].motor = motor;
+            trabalhos[t].primeira = t;
+            trabalhos[t].passo = tarefas;
+            trabalhos[t].tentativas = tentativas;
+            trabalhos[t].participantes = participantes;
+            trabalhos[t].idEvento = 1;
+            ponteiros[t] = &trabalhos[t];
+        }
+        
+        double inicio = relogio_ms();
+        executar_em_paralelo(estresse_trabalhar, ponteiros, tarefas, tarefas);
+        double duracao = relogio_ms() - inicio;
+        
+        int aceitas = 0;
+        int sem_vaga = 0;
+        int repetidas = 0;
+        FilaAceitas* filas = (FilaAceitas*)alocar_memoria((size_t)tarefas * sizeof(FilaAceitas));
+        for (int t = 0; t < tarefas; t++) {
+            aceitas += trabalhos[t].fila.quantidade;
+            sem_vaga += trabalhos[t].sem_vaga;
+            repetidas += trabalhos[t].repetidas;
+            filas[t] = trabalhos[t].fila;
+        }
+        motor_publicar(motor, filas, tarefas, NULL);
+        
+        // Conferência: vagas, inscrições do evento e participantes distintos
+        int restantes = eventos->vagasDisponiveis[0];
+        int no_evento = 0;
+        bool* vistos = (bool*)alocar_memoria((size_t)participantes + 1);
+        memset(vistos, 0, (size_t)participantes + 1);
+        for (Inscricao* i = eventos->inscricoes_inicio[0]; i != NULL; i = i->proxima_do_evento) {
+            int idParticipante = lista_participantes->registros[i->participante].id;
+            if (vistos[idParticipante]) {
+                correto = false;
+            }
+            vistos[idParticipante] = true;
+            no_evento++;
+        }
+        int sobrevenda = no_evento > capacidade ? no_evento - capacidade : 0;
+        if (sobrevenda > 0 || restantes != capacidade - no_evento || restantes < 0 || aceitas != no_evento ||
+            aceitas + sem_vaga + repetidas != tentativas) {
+            correto = false;
+        }
+        printf("%d,%.0f,%d,%d,%d,%d,%d\n", tarefas, duracao > 0 ? tentativas / (duracao / 1000.0) : 0.0,
+               aceitas, sem_vaga, repetidas, restantes, sobrevenda);
+        
+        for (int t = 0; t < tarefas; t++) {
+            liberar_memoria(filas[t].itens);
+        }
+        liberar_memoria(vistos);
+        liberar_memoria(filas);
+        liberar_memoria(ponteiros);
+        liberar_memoria(trabalhos);
+        motor_liberar(motor);
+        liberar_memoria(motor);
+        lista_inscricoes_destruir(inscricoes);
+        tabela_participantes_destruir(lista_participantes);
+        tabela_eventos_destruir(eventos);
+    }
+    
+    fprintf(stderr, correto ? "Nenhuma sobrevenda ou inscrição repetida\n"
+                            : "Falha: sobrevenda, inscrição repetida ou contagem inconsistente\n");
+    return correto;
+}
+
+// ====== INTERFACE DO USUÁRIO ======
+
+// Função para exibir o menu principal
+void exibir_menu_principal() {
+    printf("\n===== SISTEMA DE GERENCIAMENTO DE EVENTOS =====\n");
+    printf("1. Gerenciar Eventos\n");
+    printf("2. Gerenciar Participantes\n");
+    printf("3. Gerenciar Inscrições\n");
+    printf("4. Relatórios\n");
+    printf("5. Exibir Todos os Dados\n");
+    printf("6. Salvar Agora (checkpoint)\n");
+    printf("7. Compactar Arquivos de Dados\n");
+    printf("0. Sair\n");
+    printf("Escolha uma opção: ");
+}
+
+// Função para exibir o menu de eventos
+void exibir_menu_eventos() {
+    printf("\n===== GERENCIAMENTO DE EVENTOS =====\n");
+    printf("1. Adicionar Evento\n");
+    printf("2. Listar Eventos\n");
+    printf("3. Buscar Evento por ID\n");
+    printf("4. Editar Evento\n");
+    printf("5. Remover Evento\n");
+    printf("6. Ordenar Eventos por Data\n");
+    printf("7. Buscar Eventos por Texto\n");
+    printf("0. Voltar\n");
+    printf("Escolha uma opção: ");
+}
+
+// Função para exibir o menu de participantes
+void exibir_menu_participantes() {
+    printf("\n===== GERENCIAMENTO DE PARTICIPANTES =====\n");
+    printf("1. Adicionar Participante\n");
+    printf("2. Listar Participantes\n");
+    printf("3. Buscar Participante por ID\n");
+    printf("4. Editar Participante\n");
+    printf("5. Remover Participante\n");
+    printf("6. Buscar Participante por Email\n");
+    printf("7. Buscar Participante por Telefone\n");
+    printf("0. Voltar\n");
+    printf("Escolha uma opção: ");
+}
+
+// Função para exibir o menu de inscrições
+void exibir_menu_inscricoes() {
+    printf("\n===== GERENCIAMENTO DE INSCRIÇÕES =====\n");
+    printf("1. Nova Inscrição\n");
+    printf("2. Listar Inscrições por Evento\n");
+    printf("3. Listar Inscrições por Participante\n");
+    printf("4. Cancelar Inscrição\n");
+    printf("5. Consultar Lista de Espera\n");
+    printf("0. Voltar\n");
+    printf("Escolha uma opção: ");
+}
+
+// Função para exibir o menu de relatórios
+void exibir_menu_relatorios() {
+    printf("\n===== RELATÓRIOS =====\n");
+    printf("1. Eventos por Categoria\n");
+    printf("2. Eventos com Vagas Disponíveis\n");
+    printf("3. Participantes por Evento\n");
+    printf("4. Estatísticas do Sistema\n");
+    printf("5. Eventos por Período\n");
+    printf("6. Próximos Eventos\n");
+    printf("7. Estatísticas por Categoria\n");
+    printf("0. Voltar\n");
+    printf("Escolha uma opção: ");
+}
+
+// ====== FUNÇÕES PARA GERENCIAMENTO DE EVENTOS ====== 
+
+// Função para processar a adição de um evento
+void adicionar_evento(TabelaEventos* lista_eventos, int* proximoIdEvento, LogOperacoes* log) {
+    char nome[100], descricao[500], categoria[50], data[11];
+    int capacidade;
+    
+    printf("\n== Adicionar Novo Evento ==\n");
+    
+    printf("Nome do evento: ");
+    scanf(" %[^\n]", nome);
+    
+    printf("Descrição: ");
+    scanf(" %[^\n]", descricao);
+    
+    printf("Categoria: ");
+    scanf(" %[^\n]", categoria);
+    
+    printf("Data (YYYY-MM-DD): ");
+    scanf(" %10s", data);
+    
+    printf("Capacidade: ");
+    scanf("%d", &capacidade);
+    
+    uint32_t data_compactada = data_compactar(data);
+    if (data_compactada == 0) {
+        printf("\nData inválida! Use o formato YYYY-MM-DD.\n");
+        return;
+    }
+    
+    int pos = eventos_adicionar(lista_eventos, *proximoIdEvento, nome, descricao, categoria, data_compactada, capacidade);
+    log_registrar_evento(log, OP_EVENTO_CRIAR, lista_eventos, pos);
+    
+    (*proximoIdEvento)++;
+    
+    printf("\nEvento adicionado com sucesso! ID: %d\n", *proximoIdEvento - 1);
+}
+
+// Função para buscar e exibir um evento por ID
+void buscar_evento(TabelaEventos* lista_eventos) {
+    int id;
+    
+    printf("\n== Buscar Evento por ID ==\n");
+    printf("ID do evento: ");
+    scanf("%d", &id);
+    
+    int pos = eventos_buscar_por_id(lista_eventos, id);
+    
+    if (pos != -1) {
+        char data[11];
+        data_formatar(lista_eventos->data[pos], data);
+        printf("\n=== EVENTO ENCONTRADO ===\n");
+        printf("ID: %d\n", lista_eventos->id[pos]);
+        printf("Nome: %s\n", eventos_nome(lista_eventos, pos));
+        printf("Descrição: %s\n", eventos_descricao(lista_eventos, pos));
+        printf("Categoria: %s\n", eventos_categoria(lista_eventos, pos));
+        printf("Data: %s\n", data);
+        printf("Capacidade: %d\n", lista_eventos->capacidade[pos]);
+        printf("Vagas disponíveis: %d\n", eventos_vagas_livres(lista_eventos, pos));
+    } else {
+        printf("\nEvento não encontrado!\n");
+    }
+}
+
+// Função para buscar eventos por trechos do nome, da descrição ou da categoria
+void buscar_eventos_por_texto(TabelaEventos* lista_eventos) {
+    char consulta[200];
+    int resultados[BUSCA_RESULTADOS];
+    int quantidade;
+    
+    printf("\n== Buscar Eventos por Texto ==\n");
+    printf("Texto (palavras ou trechos, sem diferenciar acentos): ");
+    getchar(); // Limpar o buffer
+    if (fgets(consulta, sizeof(consulta), stdin) == NULL) {
+        return;
+    }
+    consulta[strcspn(consulta, "\n")] = 0;
+    
+    int encontrados = eventos_buscar_texto(lista_eventos, consulta, resultados, BUSCA_RESULTADOS, &quantidade);
+    if (encontrados == 0) {
+        printf("\nNenhum evento encontrado (use ao menos uma palavra com 2 letras ou mais).\n");
+        return;
+    }
+    
+    printf("\n%d evento(s) encontrado(s)", encontrados);
+    if (encontrados > quantidade) {
+        printf(", exibindo os %d mais relevantes", quantidade);
+    }
+    printf(":\n");
+    char data[11];
+    for (int k = 0; k < quantidade; k++) {
+        int pos = resultados[k];
+        data_formatar(lista_eventos->data[pos], data);
+        printf("%s - %s (ID: %d) - %s - Vagas: %d/%d\n", data, eventos_nome(lista_eventos, pos),
+               lista_eventos->id[pos], eventos_categoria(lista_eventos, pos),
+               eventos_vagas_livres(lista_eventos, pos), lista_eventos->capacidade[pos]);
+    }
+}
+
+// Função para editar um evento
+void editar_evento(TabelaEventos* lista_eventos, TabelaParticipantes* lista_participantes,
+                   ListaInscricoes* lista_inscricoes, LogOperacoes* log) {
+    int id;
+    
+    printf("\n== Editar Evento ==\n");
+    printf("ID do evento a ser editado: ");
+    scanf("%d", &id);
+    
+    int pos = eventos_buscar_por_id(lista_eventos, id);
+    
+    if (pos != -1) {
+        printf("\n=== EDITANDO EVENTO ===\n");
+        printf("Nome atual: %s\n", eventos_nome(lista_eventos, pos));
+        printf("Novo nome (ou pressione Enter para manter): ");
+        char nome[100];
+        getchar(); // Limpar o buffer
+        fgets(nome, sizeof(nome), stdin);
+        if (nome[0] != '\n') {
+            nome[strcspn(nome, "\n")] = 0; // Remover o \n do final
+            eventos_definir_nome(lista_eventos, pos, nome);
+        }
+        
+        printf("Descrição atual: %s\n", eventos_descricao(lista_eventos, pos));
+        printf("Nova descrição (ou pressione Enter para manter): ");
+        char descricao[500];
+        fgets(descricao, sizeof(descricao), stdin);
+        if (descricao[0] != '\n') {
+            descricao[strcspn(descricao, "\n")] = 0;
+            eventos_definir_descricao(lista_eventos, pos, descricao);
+        }
+        
+        printf("Categoria atual: %s\n", eventos_categoria(lista_eventos, pos));
+        printf("Nova categoria (ou pressione Enter para manter): ");
+        char categoria[50];
+        fgets(categoria, sizeof(categoria), stdin);
+        if (categoria[0] != '\n') {
+            categoria[strcspn(categoria, "\n")] = 0;
+            eventos_definir_categoria(lista_eventos, pos, categoria);
+        }
+        
+        char data[11];
+        data_formatar(lista_eventos->data[pos], data);
+        printf("Data atual: %s\n", data);
+        printf("Nova data (YYYY-MM-DD) (ou pressione Enter para manter): ");
+        fgets(data, sizeof(data), stdin);
+        if (data[0] != '\n') {
+            data[strcspn(data, "\n")] = 0;
+            uint32_t nova_data = data_compactar(data);
+            if (nova_data != 0) {
+                eventos_alterar_data(lista_eventos, pos, nova_data);
+            } else {
+                printf("Data inválida, mantendo a atual.\n");
+            }
+        }
+        
+        printf("Capacidade atual: %d\n", lista_eventos->capacidade[pos]);
+        printf("Nova capacidade (ou digite 0 para manter): ");
+        int capacidade;
+        scanf("%d", &capacidade);
+        int promovidas = 0;
+        if (capacidade > 0) {
+            // Vagas novas vão primeiro para a lista de espera
+            eventos_definir_capacidade(lista_eventos, pos, capacidade);
+            promovidas = lista_espera_promover(lista_inscricoes, lista_eventos, lista_participantes, pos);
+        }
+        log_registrar_evento(log, OP_EVENTO_ALTERAR, lista_eventos, pos);
+        if (promovidas > 0) {
+            printf("%d inscrição(ões) da lista de espera confirmada(s).\n", promovidas);
+        }
+        
+        printf("\nEvento atualizado com sucesso!\n");
+    } else {
+        printf("\nEvento não encontrado!\n");
+    }
+}
+
+// Função para remover um evento (as inscrições nele são canceladas)
+void remover_evento(TabelaEventos* lista_eventos, TabelaParticipantes* lista_participantes,
+                    ListaInscricoes* lista_inscricoes, LogOperacoes* log) {
+    int id;
+    
+    printf("\n== Remover Evento ==\n");
+    printf("ID do evento a ser removido: ");
+    scanf("%d", &id);
+    
+    int ativas = lista_inscricoes->ativas;
+    if (lista_inscricoes_remover_evento(lista_inscricoes, lista_eventos, lista_participantes, id)) {
+        log_registrar_ids(log, OP_EVENTO_REMOVER, id, 0);
+        printf("\nEvento removido com sucesso!\n");
+        if (lista_inscricoes->ativas < ativas) {
+            printf("%d inscrição(ões) no evento cancelada(s).\n", ativas - lista_inscricoes->ativas);
+        }
+    } else {
+        printf("\nEvento não encontrado!\n");
+    }
+}
+
+// ====== FUNÇÕES PARA GERENCIAMENTO DE PARTICIPANTES ====== 
+
+// Função para adicionar um participante
+void adicionar_participante(TabelaParticipantes* lista_participantes, int* proximoIdParticipante, LogOperacoes* log) {
+    char nome[100], email[100], telefone[20];
+    
+    printf("\n== Adicionar Novo Participante ==\n");
+    
+    printf("Nome: ");
+    scanf(" %[^\n]", nome);
+    
+    printf("Email: ");
+    scanf(" %[^\n]", email);
+    
+    printf("Telefone: ");
+    scanf(" %[^\n]", telefone);
+    
+    int dono = participantes_email_em_uso(lista_participantes, email, 0);
+    if (dono != -1) {
+        printf("\nErro: email já cadastrado para o participante ID %d (%s)!\n",
+               lista_participantes->registros[dono].id, participantes_nome(lista_participantes, dono));
+        return;
+    }
+    dono = participantes_buscar_por_telefone(lista_participantes, telefone, -1);
+    if (dono != -1) {
+        printf("\nAviso: telefone já cadastrado para o participante ID %d (%s).\n",
+               lista_participantes->registros[dono].id, participantes_nome(lista_participantes, dono));
+    }
+    
+    int pos = participantes_adicionar(lista_participantes, *proximoIdParticipante, nome, email, telefone);
+    log_registrar_participante(log, OP_PARTICIPANTE_CRIAR, lista_participantes, pos);
+    
+    (*proximoIdParticipante)++;
+    
+    printf("\nParticipante adicionado com sucesso! ID: %d\n", lista_participantes->registros[pos].id);
+}
+
+// Função para buscar e exibir um participante por ID
+void buscar_participante(TabelaParticipantes* lista_participantes) {
+    int id;
+    
+    printf("\n== Buscar Participante por ID ==\n");
+    printf("ID do participante: ");
+    scanf("%d", &id);
+    
+    int pos = participantes_buscar_por_id(lista_participantes, id);
+    
+    if (pos != -1) {
+        printf("\n=== PARTICIPANTE ENCONTRADO ===\n");
+        printf("ID: %d\n", lista_participantes->registros[pos].id);
+        printf("Nome: %s\n", participantes_nome(lista_participantes, pos));
+        printf("Email: %s\n", participantes_email(lista_participantes, pos));
+        printf("Telefone: %s\n", participantes_telefone(lista_participantes, pos));
+    } else {
+        printf("\nParticipante não encontrado!\n");
+    }
+}
+
+// Função para buscar e exibir os participantes com um email ou telefone
+void buscar_participante_por_contato(TabelaParticipantes* lista_participantes, bool por_email) {
+    char contato[100];
+    
+    printf("\n== Buscar Participante por %s ==\n", por_email ? "Email" : "Telefone");
+    printf("%s: ", por_email ? "Email" : "Telefone");
+    scanf(" %99[^\n]", contato);
+    
+    int encontrados = 0;
+    int pos = -1;
+    while ((pos = por_email ? participantes_buscar_por_email(lista_participantes, contato, pos)
+                            : participantes_buscar_por_telefone(lista_participantes, contato, pos)) != -1) {
+        if (encontrados++ == 0) {
+            printf("\n=== PARTICIPANTE(S) ENCONTRADO(S) ===\n");
+        }
+        printf("ID: %d\n", lista_participantes->registros[pos].id);
+        printf("Nome: %s\n", participantes_nome(lista_participantes, pos));
+        printf("Email: %s\n", participantes_email(lista_participantes, pos));
+        printf("Telefone: %s\n", participantes_telefone(lista_participantes, pos));
+        printf("--------------------\n");
+    }
+    if (encontrados == 0) {
+        printf("\nParticipante não encontrado!\n");
+    }
+}
+
+// Função para editar um participante
+void editar_participante(TabelaParticipantes* lista_participantes, LogOperacoes* log) {
+    int id;
+    
+    printf("\n== Editar Participante ==\n");
+    printf("ID do participante a ser editado: ");
+    scanf("%d", &id);
+    
+    int pos = participantes_buscar_por_id(lista_participantes, id);
+    
+    if (pos != -1) {
+        printf("\n=== EDITANDO PARTICIPANTE ===\n");
+        printf("Nome atual: %s\n", participantes_nome(lista_participantes, pos));
+        printf("Novo nome (ou pressione Enter para manter): ");
+        char nome[100];
+        getchar(); // Limpar o buffer
+        fgets(nome, sizeof(nome), stdin);
+        if (nome[0] != '\n') {
+            nome[strcspn(nome, "\n")] = 0; // Remover o \n do final
+        } else {
+            strcpy(nome, participantes_nome(lista_participantes, pos));
+        }
+        
+        printf("Email atual: %s\n", participantes_email(lista_participantes, pos));
+        printf("Novo email (ou pressione Enter para manter): ");
+        char email[100];
+        fgets(email, sizeof(email), stdin);
+        if (email[0] != '\n') {
+            email[strcspn(email, "\n")] = 0;
+            int dono = participantes_email_em_uso(lista_participantes, email, id);
+            if (dono != -1) {
+                printf("Email já cadastrado para o participante ID %d; o email atual foi mantido.\n",
+                       lista_participantes->registros[dono].id);
+                strcpy(email, participantes_email(lista_participantes, pos));
+            }
+        } else {
+            strcpy(email, participantes_email(lista_participantes, pos));
+        }
+        
+        printf("Telefone atual: %s\n", participantes_telefone(lista_participantes, pos));
+        printf("Novo telefone (ou pressione Enter para manter): ");
+        char telefone[20];
+        fgets(telefone, sizeof(telefone), stdin);
+        if (telefone[0] != '\n') {
+            telefone[strcspn(telefone, "\n")] = 0;
+        } else {
+            strcpy(telefone, participantes_telefone(lista_participantes, pos));
+        }
+        participantes_atualizar(lista_participantes, pos, nome, email, telefone);
+        log_registrar_participante(log, OP_PARTICIPANTE_ALTERAR, lista_participantes, pos);
+        
+        printf("\nParticipante atualizado com sucesso!\n");
+    } else {
+        printf("\nParticipante não encontrado!\n");
+    }
+}
+
+// Função para remover um participante (as suas inscrições são canceladas e as vagas devolvidas)
+void remover_participante(TabelaParticipantes* lista_participantes, TabelaEventos* lista_eventos,
+                          ListaInscricoes* lista_inscricoes, LogOperacoes* log) {
+    int id;
+    
+    printf("\n== Remover Participante ==\n");
+    printf("ID do participante a ser removido: ");
+    scanf("%d", &id);
+    
+    int ativas = lista_inscricoes->ativas;
+    if (lista_inscricoes_remover_participante(lista_inscricoes, lista_eventos, lista_participantes, id, true)) {
+        log_registrar_ids(log, OP_PARTICIPANTE_REMOVER, id, 0);
+        printf("\nParticipante removido com sucesso!\n");
+        if (lista_inscricoes->ativas < ativas) {
+            printf("%d inscrição(ões) do participante cancelada(s).\n", ativas - lista_inscricoes->ativas);
+        }
+    } else {
+        printf("\nParticipante não encontrado!\n");
+    }
+}
+
+// ====== FUNÇÕES PARA GERENCIAMENTO DE INSCRIÇÕES ======
+
+// Função para processar uma nova inscrição
+void nova_inscricao(TabelaEventos* lista_eventos, TabelaParticipantes* lista_participantes, 
+                    ListaInscricoes* lista_inscricoes, LogOperacoes* log) {
+    int idEvento, idParticipante;
+    
+    printf("\n== Nova Inscrição ==\n");
+    printf("ID do evento: ");
+    scanf("%d", &idEvento);
+    
+    int evento = eventos_buscar_por_id(lista_eventos, idEvento);
+    if (evento == -1) {
+        printf("\nEvento não encontrado!\n");
+        return;
+    }
+    
+    if (lista_eventos->vagasDisponiveis[evento] <= 0) {
+        printf("\nEvento lotado: a inscrição entrará na lista de espera (%d aguardando).\n",
+               lista_espera_tamanho(lista_eventos, evento));
+    }
+    
+    printf("ID do participante: ");
+    scanf("%d", &idParticipante);
+    
+    // Participante existente e ainda não inscrito (mesma verificação do modo em lote)
+    int participante = participantes_buscar_por_id(lista_participantes, idParticipante);
+    const char* impedimento = inscricao_impedimento(lista_eventos, lista_participantes, lista_inscricoes, evento,
+                                                    participante, true);
+    if (impedimento != NULL) {
+        printf("\nInscrição não realizada: %s!\n", impedimento);
+        return;
+    }
+    
+    // Obter data atual
+    char dataAtual[11];
+    obter_data_atual(dataAtual);
+    
+    // Criar e adicionar a inscrição, ocupando uma vaga ou entrando na lista de espera
+    Inscricao* nova = lista_inscricoes_inscrever(lista_inscricoes, lista_eventos, lista_participantes, participante,
+                                                 evento, dataAtual);
+    log_registrar_inscricao(log, lista_eventos, lista_participantes, nova);
+    
+    if (nova->status == PENDENTE) {
+        printf("\nInscrição na lista de espera, posição %d. Ela será confirmada quando uma vaga for liberada.\n",
+               lista_espera_posicao(lista_eventos, nova));
+    } else {
+        printf("\nInscrição realizada com sucesso!\n");
+    }
+}
+
+// Função para consultar a posição de um participante na lista de espera de um evento
+void consultar_lista_espera(TabelaEventos* lista_eventos, ListaInscricoes* lista_inscricoes) {
+    int idEvento, idParticipante;
+    
+    printf("\n== Lista de Espera ==\n");
+    printf("ID do evento: ");
+    scanf("%d", &idEvento);
+    
+    int evento = eventos_buscar_por_id(lista_eventos, idEvento);
+    if (evento == -1) {
+        printf("\nEvento não encontrado!\n");
+        return;
+    }
+    printf("Aguardando: %d\n", lista_espera_tamanho(lista_eventos, evento));
+    
+    printf("ID do participante: ");
+    scanf("%d", &idParticipante);
+    
+    Inscricao* inscricao = (Inscricao*)indice_buscar(&lista_inscricoes->indice,
+                                                     indice_chave_inscricao(idParticipante, idEvento));
+    if (inscricao == NULL) {
+        printf("\nO participante não está inscrito neste evento.\n");
+    } else if (inscricao->status == PENDENTE) {
+        printf("\nPosição na lista de espera: %d de %d\n", lista_espera_posicao(lista_eventos, inscricao),
+               lista_espera_tamanho(lista_eventos, evento));
+    } else {
+        printf("\nInscrição já confirmada.\n");
+    }
+}
+
+// Função para cancelar uma inscrição
+void cancelar_inscricao(TabelaEventos* lista_eventos, TabelaParticipantes* lista_participantes,
+                        ListaInscricoes* lista_inscricoes, LogOperacoes* log) {
+    int idEvento, idParticipante;
+    
+    printf("\n== Cancelar Inscrição ==\n");
+    printf("ID do evento: ");
+    scanf("%d", &idEvento);
+    
+    printf("ID do participante: ");
+    scanf("%d", &idParticipante);
+    
+    if (lista_inscricoes_cancelar(lista_inscricoes, lista_eventos, lista_participantes, idParticipante, idEvento)) {
+        log_registrar_ids(log, OP_INSCRICAO_CANCELAR, idParticipante, idEvento);
+        printf("\nInscrição cancelada com sucesso!\n");
+    } else {
+        printf("\nInscrição não encontrada ou já cancelada!\n");
+    }
+}
+
+// ====== FUNÇÕES PARA RELATÓRIOS ======
+
+// Função para gerar relatório de eventos por categoria (lista de postagem, sem varrer a tabela)
+void relatorio_eventos_por_categoria(TabelaEventos* lista_eventos) {
+    char categoria[50];
+    char data[11];
+    
+    printf("\n== Relatório: Eventos por Categoria ==\n");
+    printf("Informe a categoria: ");
+    scanf(" %49[^\n]", categoria);
+    
+    printf("\n=== EVENTOS DA CATEGORIA: %s ===\n", categoria);
+    
+    int id = indice_categorias_buscar(&lista_eventos->categorias, categoria);
+    Categoria* c = id == -1 ? NULL : &lista_eventos->categorias.categorias[id];
+    if (c == NULL || c->quantidade == 0) {
+        printf("Nenhum evento encontrado nesta categoria.\n");
+        return;
+    }
+    
+    // A lista de postagem não guarda ordem: ordenar só os eventos encontrados por data
+    ChaveOrdenacao* pares = (ChaveOrdenacao*)alocar_memoria(c->quantidade * sizeof(ChaveOrdenacao));
+    ChaveOrdenacao* auxiliar = (ChaveOrdenacao*)alocar_memoria(c->quantidade * sizeof(ChaveOrdenacao));
+    for (int k = 0; k < c->quantidade; k++) {
+        pares[k].pos = c->eventos[k];
+        pares[k].chave = eventos_chave_data(lista_eventos, c->eventos[k]);
+    }
+    radix_sort_chaves(pares, auxiliar, c->quantidade);
+    
+    for (int k = 0; k < c->quantidade; k++) {
+        int pos = pares[k].pos;
+        data_formatar(lista_eventos->data[pos], data);
+        printf("ID: %d\n", lista_eventos->id[pos]);
+        printf("Nome: %s\n", eventos_nome(lista_eventos, pos));
+        printf("Data: %s\n", data);
+        printf("Vagas: %d/%d\n", eventos_vagas_livres(lista_eventos, pos), lista_eventos->capacidade[pos]);
+        printf("--------------------\n");
+    }
+    
+    liberar_memoria(auxiliar);
+    liberar_memoria(pares);
+}
+
+// Função para gerar estatísticas por categoria (totais mantidos a cada alteração, sem varredura)
+void relatorio_estatisticas_por_categoria(TabelaEventos* lista_eventos) {
+    bool encontrado = false;
+    
+    printf("\n== Relatório: Estatísticas por Categoria ==\n");
+    for (int id = 0; id < lista_eventos->categorias.quantidade; id++) {
+        const Categoria* c = &lista_eventos->categorias.categorias[id];
+        if (c->quantidade == 0) {
+            continue;
+        }
+        
+        long inscritos = c->capacidade_total - c->vagas_total;
+        double ocupacao = c->capacidade_total > 0 ? 100.0 * inscritos / c->capacidade_total : 0.0;
+        printf("Categoria: %s\n", c->nome);
+        printf("Eventos: %d | Capacidade total: %ld | Inscritos: %ld | Ocupação: %.1f%%\n",
+               c->quantidade, c->capacidade_total, inscritos, ocupacao);
+        printf("--------------------\n");
+        encontrado = true;
+    }
+    
+    if (!encontrado) {
+        printf("Nenhuma categoria cadastrada.\n");
+    }
+}
+
+// Função para gerar relatório de eventos com vagas disponíveis
+void relatorio_eventos_com_vagas(TabelaEventos* lista_eventos) {
+    bool encontrado = false;
+    char data[11];
+    
+    printf("\n== Relatório: Eventos com Vagas Disponíveis ==\n");
+    
+    // A varredura só toca as colunas de encadeamento e de vagas
+    for (int pos = lista_eventos->inicio; pos != -1; pos = lista_eventos->proximo[pos]) {
+        if (lista_eventos->vagasDisponiveis[pos] > 0) {
+            data_formatar(lista_eventos->data[pos], data);
+            printf("ID: %d\n", lista_eventos->id[pos]);
+            printf("Nome: %s\n", eventos_nome(lista_eventos, pos));
+            printf("Categoria: %s\n", eventos_categoria(lista_eventos, pos));
+            printf("Data: %s\n", data);
+            printf("Vagas disponíveis: %d\n", eventos_vagas_livres(lista_eventos, pos));
+            printf("--------------------\n");
+            encontrado = true;
+        }
+    }
+    
+    if (!encontrado) {
+        printf("Nenhum evento com vagas disponíveis.\n");
+    }
+}
+
+// Função para gerar relatório de participantes por evento
+void relatorio_participantes_por_evento(TabelaEventos* lista_eventos, TabelaParticipantes* lista_participantes) {
+    int idEvento;
+    
+    printf("\n== Relatório: Participantes por Evento ==\n");
+    printf("ID do evento: ");
+    scanf("%d", &idEvento);
+    
+    lista_inscricoes_por_evento(lista_eventos, lista_participantes, idEvento);
+}
+
+// Função para gerar estatísticas do sistema
+void relatorio_estatisticas(TabelaEventos* lista_eventos, TabelaParticipantes* lista_participantes, 
+                           ListaInscricoes* lista_inscricoes) {
+    int total_eventos = contar_eventos(lista_eventos);
+    
+    printf("\n== Relatório: Estatísticas do Sistema ==\n");
+    printf("Total de eventos: %d\n", total_eventos);
+    printf("Total de participantes: %d\n", lista_participantes->tamanho);
+    printf("Total de inscrições: %d\n", lista_inscricoes->tamanho);
+    
+    // Calcular média de inscrições por evento
+    if (total_eventos > 0) {
+        float media = (float)lista_inscricoes->tamanho / total_eventos;
+        printf("Média de inscrições por evento: %.2f\n", media);
+    }
+    
+    // Encontrar evento com mais inscrições
+    if (total_eventos > 0) {
+        // Varredura contígua das colunas de capacidade e vagas
+        const int* capacidade = lista_eventos->capacidade;
+        const int* vagas = lista_eventos->vagasDisponiveis;
+        int max_inscricoes = 0;
+        int pos_max = -1;
+        
+        for (int pos = 0; pos < lista_eventos->usados; pos++) {
+            int inscricoes = capacidade[pos] - vagas[pos];
+            if (inscricoes > max_inscricoes && lista_eventos->ativo[pos]) {
+                max_inscricoes = inscricoes;
+                pos_max = pos;
+            }
+        }
+        
+        if (pos_max != -1) {
+            printf("Evento com mais inscrições: %s (ID: %d) - %d inscrições\n", 
+                   eventos_nome(lista_eventos, pos_max), lista_eventos->id[pos_max], max_inscricoes);
+        }
+    }
+    
+    // Lápides: canceladas que ainda ocupam as listas até a próxima compactação
+    int canceladas = lista_inscricoes_canceladas(lista_inscricoes);
+    printf("Inscrições canceladas ainda em memória: %d (%.1f%%)\n", canceladas,
+           lista_inscricoes->tamanho > 0 ? 100.0 * canceladas / lista_inscricoes->tamanho : 0.0);
+    printf("Arquivadas nesta sessão: %d | bytes recuperados: %zu\n",
+           lista_inscricoes->arquivadas, lista_inscricoes->bytes_recuperados);
+    
+    // Uso de memória dos nós de entidades
+    printf("\n-- Memória (%s) --\n", USAR_ALOCADOR_SLAB ? "alocador em blocos" : "malloc por nó");
+    printf("Eventos: tabela em colunas com %d posições | bytes reservados: %zu | textos descartados: %zu bytes\n",
+           lista_eventos->alocadas, tabela_eventos_bytes(lista_eventos), lista_eventos->textos.desperdicio);
+    printf("Participantes: tabela contígua com %d posições (%d livres) de %zu bytes | bytes reservados: %zu | "
+           "textos: %zu bytes (%zu descartados)\n",
+           lista_participantes->alocados, lista_participantes->alocados - lista_participantes->tamanho,
+           sizeof(Participante), tabela_participantes_bytes(lista_participantes), lista_participantes->textos.tamanho,
+           lista_participantes->textos.desperdicio);
+    slab_exibir_estatisticas(&slab_inscricoes);
+}
+
+// Função para exibir os eventos a partir de um nó do índice de datas, até a chave limite (exclusiva)
+static int exibir_eventos_desde(TabelaEventos* lista_eventos, NoData* no, uint64_t limite, int maximo) {
+    char data[11];
+    int exibidos = 0;
+    
+    for (; no != NULL && no->chave < limite && exibidos < maximo; no = no->enlaces[0].proximo) {
+        int pos = no->pos;
+        data_formatar(lista_eventos->data[pos], data);
+        printf("ID: %d\n", lista_eventos->id[pos]);
+        printf("Nome: %s\n", eventos_nome(lista_eventos, pos));
+        printf("Categoria: %s\n", eventos_categoria(lista_eventos, pos));
+        printf("Data: %s\n", data);
+        printf("Vagas disponíveis: %d/%d\n", eventos_vagas_livres(lista_eventos, pos), lista_eventos->capacidade[pos]);
+        printf("--------------------\n");
+        exibidos++;
+    }
+    return exibidos;
+}
+
+// Função para gerar relatório de eventos em um período (busca no índice de datas)
+void relatorio_eventos_por_periodo(TabelaEventos* lista_eventos) {
+    char inicio[11], fim[11];
+    
+    printf("\n== Relatório: Eventos por Período ==\n");
+    printf("Data inicial (AAAA-MM-DD): ");
+    scanf(" %10s", inicio);
+    printf("Data final (AAAA-MM-DD): ");
+    scanf(" %10s", fim);
+    
+    uint32_t data_inicio = data_compactar(inicio);
+    uint32_t data_fim = data_compactar(fim);
+    if (data_inicio == 0 || data_fim == 0 || data_inicio > data_fim) {
+        printf("\nPeríodo inválido!\n");
+        return;
+    }
+    
+    // Chaves são (data << 32 | id): o intervalo cobre todos os IDs de cada data
+    uint64_t chave_inicio = (uint64_t)data_inicio << 32;
+    uint64_t chave_fim = ((uint64_t)data_fim + 1) << 32;
+    
+    int total = indice_datas_contar(&lista_eventos->datas, chave_inicio, chave_fim);
+    printf("Eventos entre %s e %s: %d\n\n", inicio, fim, total);
+    
+    exibir_eventos_desde(lista_eventos, indice_datas_primeiro_a_partir(&lista_eventos->datas, chave_inicio),
+                         chave_fim, total);
+}
+
+// Função para gerar relatório dos próximos eventos a partir da data atual
+void relatorio_proximos_eventos(TabelaEventos* lista_eventos) {
+    char hoje[11];
+    int quantidade;
+    
+    printf("\n== Relatório: Próximos Eventos ==\n");
+    printf("Quantidade de eventos: ");
+    scanf("%d", &quantidade);
+    if (quantidade <= 0) {
+        printf("\nQuantidade inválida!\n");
+        return;
+    }
+    
+    obter_data_atual(hoje);
+    uint64_t chave_hoje = (uint64_t)data_compactar(hoje) << 32;
+    
+    int exibidos = exibir_eventos_desde(lista_eventos, indice_datas_primeiro_a_partir(&lista_eventos->datas, chave_hoje),
+                                        UINT64_MAX, quantidade);
+    if (exibidos == 0) {
+        printf("Nenhum evento a partir de %s.\n", hoje);
+    }
+}
+
+// ====== VISÕES APÓS CADA OPERAÇÃO ======
+
+#define RESUMO_EVENTOS 5
+
+// Função para exibir um resumo limitado (contadores mantidos e primeiros eventos por data)
+void exibir_resumo(TabelaEventos* lista_eventos, TabelaParticipantes* lista_participantes,
+                   ListaInscricoes* lista_inscricoes) {
+    printf("\n=== RESUMO ===\n");
+    printf("Eventos: %d | Participantes: %d | Inscrições: %d (ativas: %d)\n",
+           contar_eventos(lista_eventos), lista_participantes->tamanho,
+           lista_inscricoes->tamanho, lista_inscricoes->ativas);
+    
+    if (lista_eventos->inicio == -1) {
+        printf("Nenhum evento cadastrado.\n");
+        return;
+    }
+    
+    printf("\nPrimeiros eventos por data:\n");
+    char data[11];
+    int exibidos = 0;
+    for (int pos = lista_eventos->inicio; pos != -1 && exibidos < RESUMO_EVENTOS;
+         pos = lista_eventos->proximo[pos]) {
+        data_formatar(lista_eventos->data[pos], data);
+        printf("  %s - %s (ID: %d) - Vagas: %d/%d\n", data, eventos_nome(lista_eventos, pos),
+               lista_eventos->id[pos], eventos_vagas_livres(lista_eventos, pos), lista_eventos->capacidade[pos]);
+        exibidos++;
+    }
+    
+    if (contar_eventos(lista_eventos) > exibidos) {
+        printf("  ... e mais %d evento(s). Use a opção 5 para exibir todos os dados.\n",
+               contar_eventos(lista_eventos) - exibidos);
+    }
+}
+
+// Função para exibir todos os eventos, participantes e inscrições
+void exibir_todos_os_dados(TabelaEventos* lista_eventos, TabelaParticipantes* lista_participantes,
+                           ListaInscricoes* lista_inscricoes) {
+    printf("\n=== LISTA DE EVENTOS ===\n");
+    printf("Total de eventos: %d\n", contar_eventos(lista_eventos));
+    eventos_listar(lista_eventos);
+    printf("\n=== LISTA DE PARTICIPANTES ===\n");
+    printf("Total de participantes: %d\n", lista_participantes->tamanho);
+    participantes_listar(lista_participantes);
+    printf("\n=== LISTA DE INSCRIÇÕES ===\n");
+    printf("Total de inscrições: %d\n", lista_inscricoes->tamanho);
+    if (lista_inscricoes->tamanho > 0) {
+        Inscricao* inscricao_atual = lista_inscricoes->inicio;
+        while (inscricao_atual != NULL) {
+            printf("Participante: %s (ID: %d) - Evento: %s (ID: %d) - Status: %s\n", 
+                   participantes_nome(lista_participantes, inscricao_atual->participante), 
+                   lista_participantes->registros[inscricao_atual->participante].id, 
+                   eventos_nome(lista_eventos, inscricao_atual->evento), 
+                   lista_eventos->id[inscricao_atual->evento], 
+                   inscricao_atual->status == CONFIRMADA ? "Confirmada" :
+                   inscricao_atual->status == PENDENTE ? "Na lista de espera" : "Cancelada");
+            inscricao_atual = inscricao_atual->proxima;
+        }
+    } else {
+        printf("Nenhuma inscrição registrada.\n");
+    }
+    printf("\n=== FIM DA LISTA ===\n");
+}
+
+// ====== LEITURA DE CSV ======
+
+#define CSV_BUFFER_INICIAL (1 << 20)
+#define CSV_MAX_CAMPOS 16
+
+// Leitor de CSV (RFC 4180) em fluxo: os registros são lidos em blocos grandes e os campos
+// apontam para o próprio buffer, sem cópias por campo
+typedef struct leitor_csv {
+    FILE* arquivo;
+    const char* nome_arquivo;
+    char* buffer;
+    size_t capacidade;
+    size_t inicio;          // Início do próximo registro no buffer
+    size_t fim;             // Bytes válidos no buffer
+    bool fim_arquivo;
+    long linha;             // Linha em que começa o registro atual
+    long proxima_linha;
+    char* campos[CSV_MAX_CAMPOS];
+    size_t tamanhos[CSV_MAX_CAMPOS];
+    int colunas[CSV_MAX_CAMPOS]; // Coluna (em caracteres) em que cada campo começa
+    int quantidade;
+    int erro_coluna;
+    char erro[128];
+} LeitorCSV;
+
+// Função para abrir um arquivo CSV para leitura ("-" é a entrada padrão; false se não existir)
+bool csv_abrir(LeitorCSV* leitor, const char* filename) {
+    leitor->arquivo = strcmp(filename, "-") == 0 ? stdin : fopen(filename, "rb");
+    if (leitor->arquivo == NULL) {
+        return false;
+    }
+    leitor->nome_arquivo = filename;
+    leitor->capacidade = CSV_BUFFER_INICIAL;
+    // Um byte extra garante espaço para o '\0' do último registro sem quebra de linha
+    leitor->buffer = (char*)alocar_memoria(leitor->capacidade + 1);
+    leitor->inicio = 0;
+    leitor->fim = 0;
+    leitor->fim_arquivo = false;
+    leitor->linha = 0;
+    leitor->proxima_linha = 1;
+    leitor->quantidade = 0;
+    leitor->erro_coluna = 0;
+    leitor->erro[0] = '\0';
+    
+    // Ignorar a marca de ordem de bytes do UTF-8, se houver
+    leitor->fim = fread(leitor->buffer, 1, leitor->capacidade, leitor->arquivo);
+    if (leitor->fim >= 3 && memcmp(leitor->buffer, "\xEF\xBB\xBF", 3) == 0) {
+        leitor->inicio = 3;
+    }
+    return true;
+}
+
+// Função para ler os registros de um trecho já carregado na memória, começando na linha informada
+// (os campos são separados no próprio trecho, que deve terminar em quebra de linha ou ter um byte
+// livre logo após o fim; o trecho continua pertencendo a quem chamou)
+void csv_abrir_memoria(LeitorCSV* leitor, const char* filename, char* dados, size_t tamanho, long primeira_linha) {
+    leitor->arquivo = NULL;
+    leitor->nome_arquivo = filename;
+    leitor->buffer = dados;
+    leitor->capacidade = tamanho;
+    leitor->inicio = 0;
+    leitor->fim = tamanho;
+    leitor->fim_arquivo = true;
+    leitor->linha = 0;
+    leitor->proxima_linha = primeira_linha;
+    leitor->quantidade = 0;
+    leitor->erro_coluna = 0;
+    leitor->erro[0] = '\0';
+}
+
+// Função para fechar o leitor e liberar o buffer
+void csv_fechar(LeitorCSV* leitor) {
+    if (leitor->arquivo == NULL) {
+        return;
+    }
+    if (leitor->arquivo != stdin) {
+        fclose(leitor->arquivo);
+    }
+    liberar_memoria(leitor->buffer);
+    leitor->buffer = NULL;
+}
+
+// Função para registrar um erro no registro atual, indicando o campo (ou -1 para o registro todo)
+bool csv_registrar_erro(LeitorCSV* leitor, int campo, const char* mensagem) {
+    leitor->erro_coluna = campo >= 0 && campo < leitor->quantidade ? leitor->colunas[campo] : 1;
+    snprintf(leitor->erro, sizeof(leitor->erro), "%s", mensagem);
+    return false;
+}
+
+// Função para formatar uma mensagem de erro com arquivo, linha e coluna
+int csv_formatar_erro(char* destino, size_t tamanho, const char* filename, long linha, int coluna,
+                      const char* mensagem) {
+    return snprintf(destino, tamanho, "Erro em %s (linha %ld, coluna %d): %s\n", filename, linha, coluna, mensagem);
+}
+
+// Função para exibir o último erro com arquivo, linha e coluna
+void csv_reportar_erro(const LeitorCSV* leitor) {
+    char mensagem[512];
+    csv_formatar_erro(mensagem, sizeof(mensagem), leitor->nome_arquivo, leitor->linha, leitor->erro_coluna,
+                      leitor->erro);
+    fputs(mensagem, stderr);
+}
+
+// Função para trazer mais dados do arquivo, preservando o registro em andamento
+// (devolve quantos bytes o conteúdo foi deslocado para o início do buffer)
+static size_t csv_recarregar(LeitorCSV* leitor) {
+    size_t deslocamento = leitor->inicio;
+    if (deslocamento > 0) {
+        memmove(leitor->buffer, leitor->buffer + deslocamento, leitor->fim - deslocamento);
+        leitor->fim -= deslocamento;
+        leitor->inicio = 0;
+    }
+    
+    // Registro maior que o buffer: dobrar a capacidade
+    if (leitor->fim == leitor->capacidade) {
+        leitor->capacidade *= 2;
+        char* novo = (char*)realloc(leitor->buffer, leitor->capacidade + 1);
+        if (novo == NULL) {
+            fprintf(stderr, "Erro de alocação de memória!\n");
+            exit(EXIT_FAILURE);
+        }
+        leitor->buffer = novo;
+    }
+    
+    size_t lidos = fread(leitor->buffer + leitor->fim, 1, leitor->capacidade - leitor->fim, leitor->arquivo);
+    if (lidos == 0) {
+        leitor->fim_arquivo = true;
+    }
+    leitor->fim += lidos;
+    return deslocamento;
+}
+
+// Função para separar os campos de um registro já delimitado, no próprio buffer
+static int csv_separar_campos(LeitorCSV* leitor, char* registro) {
+    char* p = registro;
+    leitor->quantidade = 0;
+    
+    for (;;) {
+        if (leitor->quantidade == CSV_MAX_CAMPOS) {
+            csv_registrar_erro(leitor, CSV_MAX_CAMPOS - 1, "campos demais no registro");
+            return -1;
+        }
+        int campo = leitor->quantidade++;
+        leitor->colunas[campo] = (int)(p - registro) + 1;
+        
+        if (*p == '"') {
+            // Campo entre aspas: "" representa uma aspa; o conteúdo é compactado no lugar
+            char* escrita = p;
+            char* leitura = p + 1;
+            leitor->campos[campo] = p;
+            for (;;) {
+                if (*leitura == '\0') {
+                    csv_registrar_erro(leitor, campo, "aspas não fechadas");
+                    return -1;
+                }
+                if (*leitura == '"') {
+                    if (leitura[1] != '"') {
+                        leitura++;
+                        break;
+                    }
+                    leitura++;
+                }
+                *escrita++ = *leitura++;
+            }
+            if (*leitura != ',' && *leitura != '\0') {
+                leitor->erro_coluna = (int)(leitura - registro) + 1;
+                snprintf(leitor->erro, sizeof(leitor->erro), "caractere inesperado após as aspas");
+                return -1;
+            }
+            leitor->tamanhos[campo] = (size_t)(escrita - p);
+            *escrita = '\0';
+            p = leitura;
+        } else {
+            char* separador = p;
+            while (*separador != ',' && *separador != '\0') {
+                separador++;
+            }
+            leitor->campos[campo] = p;
+            leitor->tamanhos[campo] = (size_t)(separador - p);
+            p = separador;
+        }
+        
+        if (*p == '\0') {
+            return 1;
+        }
+        *p++ = '\0';
+    }
+}
+
+// Função para ler o próximo registro (1 se lido, 0 no fim do arquivo, -1 se o registro tem erro;
+// após um erro a leitura continua normalmente no registro seguinte)
+int csv_proximo_registro(LeitorCSV* leitor) {
+    for (;;) {
+        // Delimitar o registro: a quebra de linha só conta fora de aspas
+        size_t i = leitor->inicio;
+        bool entre_aspas = false;
+        long quebras = 0;
+        size_t quebra = SIZE_MAX; // Próxima quebra de linha conhecida (SIZE_MAX: procurar)
+        
+        for (;;) {
+            char* base = leitor->buffer;
+            size_t fim = leitor->fim;
+            
+            if (entre_aspas) {
+                // Dentro de aspas só interessa a próxima aspa ("" fecha e reabre)
+                char* aspa = (char*)memchr(base + i, '"', fim - i);
+                size_t ate = aspa != NULL ? (size_t)(aspa - base) : fim;
+                for (size_t k = i; k < ate; k++) {
+                    quebras += base[k] == '\n';
+                }
+                i = ate;
+                if (aspa != NULL) {
+                    i++;
+                    entre_aspas = false;
+                    continue;
+                }
+            } else {
+                // Fora de aspas: o registro termina na quebra, a menos que uma aspa apareça antes
+                if (quebra == SIZE_MAX || quebra < i) {
+                    char* q = (char*)memchr(base + i, '\n', fim - i);
+                    quebra = q != NULL ? (size_t)(q - base) : fim;
+                }
+                char* aspa = (char*)memchr(base + i, '"', quebra - i);
+                if (aspa != NULL) {
+                    i = (size_t)(aspa - base) + 1;
+                    entre_aspas = true;
+                    continue;
+                }
+                i = quebra;
+                if (i < fim) {
+                    break;
+                }
+            }
+            
+            // Fim dos dados no buffer sem fechar o registro
+            if (leitor->fim_arquivo) {
+                break;
+            }
+            size_t deslocamento = csv_recarregar(leitor);
+            i -= deslocamento;
+            quebra = SIZE_MAX;
+            if (i == leitor->fim && leitor->fim_arquivo) {
+                break;
+            }
+        }
+        
+        size_t inicio = leitor->inicio;
+        if (i == inicio && i == leitor->fim) {
+            return 0;
+        }
+        
+        leitor->inicio = i < leitor->fim ? i + 1 : i;
+        leitor->linha = leitor->proxima_linha;
+        leitor->proxima_linha += 1 + quebras;
+        
+        // Aceitar finais de linha CRLF
+        size_t termino = i;
+        if (termino > inicio && leitor->buffer[termino - 1] == '\r') {
+            termino--;
+        }
+        leitor->buffer[termino] = '\0';
+        
+        // Linhas em branco são ignoradas
+        if (termino == inicio) {
+            continue;
+        }
+        
+        return csv_separar_campos(leitor, leitor->buffer + inicio);
+    }
+}
+
+// Função para conferir a quantidade de campos do registro atual
+bool csv_verificar_campos(LeitorCSV* leitor, int esperados) {
+    if (leitor->quantidade != esperados) {
+        char mensagem[64];
+        snprintf(mensagem, sizeof(mensagem), "esperados %d campos, encontrados %d", esperados, leitor->quantidade);
+        return csv_registrar_erro(leitor, leitor->quantidade < esperados ? leitor->quantidade - 1 : esperados,
+                                  mensagem);
+    }
+    return true;
+}
+
+// Função para converter um campo em inteiro, rejeitando textos incompletos ou fora da faixa
+bool csv_campo_inteiro(LeitorCSV* leitor, int campo, int* valor) {
+    const char* texto = leitor->campos[campo];
+    const char* fim = texto + leitor->tamanhos[campo];
+    bool negativo = texto < fim && *texto == '-';
+    if (negativo || (texto < fim && *texto == '+')) {
+        texto++;
+    }
+    
+    // Conversão direta (sem strtol): só dígitos, com verificação de estouro
+    long long numero = 0;
+    if (texto == fim) {
+        return csv_registrar_erro(leitor, campo, "número inteiro inválido");
+    }
+    for (; texto < fim; texto++) {
+        if (*texto < '0' || *texto > '9' || numero > INT_MAX) {
+            return csv_registrar_erro(leitor, campo, "número inteiro inválido");
+        }
+        numero = numero * 10 + (*texto - '0');
+    }
+    if (negativo) {
+        numero = -numero;
+    }
+    if (numero < INT_MIN || numero > INT_MAX) {
+        return csv_registrar_erro(leitor, campo, "número inteiro inválido");
+    }
+    *valor = (int)numero;
+    return true;
 }
 
-// Função para contar eventos na lista
-int contar_eventos(Evento* lista) {
-    int contador = 0;
-    Evento* atual = lista;
+// Função para converter um campo de data no formato YYYY-MM-DD
+bool csv_campo_data(LeitorCSV* leitor, int campo, uint32_t* data) {
+    *data = data_compactar_estrita(leitor->campos[campo], leitor->tamanhos[campo]);
+    if (*data == 0) {
+        return csv_registrar_erro(leitor, campo, "data inválida (esperado AAAA-MM-DD)");
+    }
+    return true;
+}
+
+// Função para validar o comprimento de um campo que será copiado para um texto de tamanho fixo
+bool csv_campo_texto(LeitorCSV* leitor, int campo, size_t limite) {
+    if (leitor->tamanhos[campo] >= limite) {
+        char mensagem[64];
+        snprintf(mensagem, sizeof(mensagem), "texto com mais de %zu caracteres", limite - 1);
+        return csv_registrar_erro(leitor, campo, mensagem);
+    }
+    return true;
+}
+
+// ====== ESCRITA DE CSV ======
+
+#define CSV_BUFFER_ESCRITA (1 << 20)
+
+// Escritor de CSV: formata em um buffer grande, grava em um arquivo temporário e
+// só substitui o arquivo final (fsync + rename) quando tudo foi gravado
+typedef struct escritor_csv {
+    FILE* arquivo;
+    const char* caminho;
+    char* temporario;       // caminho + ".tmp"
+    char* buffer;
+    size_t usados;
+    bool inicio_registro;   // Próximo campo é o primeiro do registro (sem vírgula antes)
+    bool falhou;
+} EscritorCSV;
+
+// Função para criar o arquivo temporário que receberá o conteúdo
+bool csv_criar(EscritorCSV* escritor, const char* filename) {
+    size_t comprimento = strlen(filename);
+    escritor->temporario = (char*)alocar_memoria(comprimento + 5);
+    memcpy(escritor->temporario, filename, comprimento);
+    memcpy(escritor->temporario + comprimento, ".tmp", 5);
     
-    while (atual != NULL) {
-        contador++;
-        atual = atual->proximo;
+    escritor->arquivo = fopen(escritor->temporario, "wb");
+    if (escritor->arquivo == NULL) {
+        fprintf(stderr, "Erro ao criar %s\n", escritor->temporario);
+        liberar_memoria(escritor->temporario);
+        return false;
+    }
+    escritor->caminho = filename;
+    escritor->buffer = (char*)alocar_memoria(CSV_BUFFER_ESCRITA);
+    escritor->usados = 0;
+    escritor->inicio_registro = true;
+    escritor->falhou = false;
+    return true;
+}
+
+// Função para abrir um arquivo para acrescentar registros no fim (sem arquivo temporário); devolve
+// em vazio se o arquivo ainda não tinha conteúdo, para quem precisa escrever o cabeçalho
+bool csv_abrir_acrescimo(EscritorCSV* escritor, const char* filename, bool* vazio) {
+    escritor->arquivo = fopen(filename, "ab");
+    if (escritor->arquivo == NULL) {
+        fprintf(stderr, "Erro ao abrir %s\n", filename);
+        return false;
+    }
+    fseek(escritor->arquivo, 0, SEEK_END);
+    *vazio = ftell(escritor->arquivo) == 0;
+    escritor->caminho = filename;
+    escritor->temporario = NULL;
+    escritor->buffer = (char*)alocar_memoria(CSV_BUFFER_ESCRITA);
+    escritor->usados = 0;
+    escritor->inicio_registro = true;
+    escritor->falhou = false;
+    return true;
+}
+
+// Função para escrever registros em um arquivo já aberto pelo chamador, como a saída padrão (sem
+// arquivo temporário; concluído por csv_concluir_saida, que não o fecha)
+void csv_abrir_saida(EscritorCSV* escritor, FILE* arquivo, const char* nome) {
+    escritor->arquivo = arquivo;
+    escritor->caminho = nome;
+    escritor->temporario = NULL;
+    escritor->buffer = (char*)alocar_memoria(CSV_BUFFER_ESCRITA);
+    escritor->usados = 0;
+    escritor->inicio_registro = true;
+    escritor->falhou = false;
+}
+
+// Função para descarregar o buffer no arquivo
+static void csv_descarregar(EscritorCSV* escritor) {
+    if (escritor->usados > 0 && !escritor->falhou &&
+        fwrite(escritor->buffer, 1, escritor->usados, escritor->arquivo) != escritor->usados) {
+        escritor->falhou = true;
+    }
+    escritor->usados = 0;
+}
+
+// Função para acrescentar bytes sem formatação
+void csv_escrever_bruto(EscritorCSV* escritor, const char* dados, size_t tamanho) {
+    if (escritor->usados + tamanho > CSV_BUFFER_ESCRITA) {
+        csv_descarregar(escritor);
+        // Blocos maiores que o buffer vão direto para o arquivo
+        if (tamanho > CSV_BUFFER_ESCRITA) {
+            if (!escritor->falhou && fwrite(dados, 1, tamanho, escritor->arquivo) != tamanho) {
+                escritor->falhou = true;
+            }
+            return;
+        }
+    }
+    memcpy(escritor->buffer + escritor->usados, dados, tamanho);
+    escritor->usados += tamanho;
+}
+
+// Função para garantir espaço contíguo no buffer, devolvendo onde escrever
+// (tamanho deve ser no máximo CSV_BUFFER_ESCRITA)
+static char* csv_reservar(EscritorCSV* escritor, size_t tamanho) {
+    if (escritor->usados + tamanho > CSV_BUFFER_ESCRITA) {
+        csv_descarregar(escritor);
+    }
+    return escritor->buffer + escritor->usados;
+}
+
+// Função para iniciar um novo campo (vírgula antes, exceto no primeiro do registro)
+static char* csv_iniciar_campo(EscritorCSV* escritor, char* destino) {
+    if (!escritor->inicio_registro) {
+        *destino++ = ',';
     }
+    escritor->inicio_registro = false;
+    return destino;
+}
+
+// Função para escrever um inteiro sem printf
+void csv_escrever_inteiro(EscritorCSV* escritor, int valor) {
+    char digitos[11];
+    int n = sizeof(digitos);
+    unsigned int absoluto = valor < 0 ? 0u - (unsigned int)valor : (unsigned int)valor;
     
-    return contador;
+    do {
+        digitos[--n] = (char)('0' + absoluto % 10);
+        absoluto /= 10;
+    } while (absoluto != 0);
+    
+    char* destino = csv_iniciar_campo(escritor, csv_reservar(escritor, 2 + sizeof(digitos)));
+    if (valor < 0) {
+        *destino++ = '-';
+    }
+    memcpy(destino, digitos + n, sizeof(digitos) - n);
+    escritor->usados = (size_t)(destino + sizeof(digitos) - n - escritor->buffer);
 }
 
-// ====== INTERFACE DO USUÁRIO ======
+// Função para escrever uma data compactada como YYYY-MM-DD sem printf
+void csv_escrever_data(EscritorCSV* escritor, uint32_t data) {
+    // Reserva 12 bytes: vírgula, 10 caracteres da data e o '\0' escrito por data_formatar
+    char* destino = csv_iniciar_campo(escritor, csv_reservar(escritor, 12));
+    data_formatar(data, destino);
+    escritor->usados = (size_t)(destino + 10 - escritor->buffer);
+}
 
-// Função para exibir o menu principal
-void exibir_menu_principal() {
-    printf("\n===== SISTEMA DE GERENCIAMENTO DE EVENTOS =====\n");
-    printf("1. Gerenciar Eventos\n");
-    printf("2. Gerenciar Participantes\n");
-    printf("3. Gerenciar Inscrições\n");
-    printf("4. Relatórios\n");
-    printf("0. Sair\n");
-    printf("Escolha uma opção: ");
+// Função para escrever um campo sem aspas (cabeçalhos e valores já validados)
+void csv_escrever_simples(EscritorCSV* escritor, const char* texto) {
+    size_t comprimento = strlen(texto);
+    if (comprimento + 1 > CSV_BUFFER_ESCRITA) {
+        if (!escritor->inicio_registro) {
+            csv_escrever_bruto(escritor, ",", 1);
+        }
+        escritor->inicio_registro = false;
+        csv_escrever_bruto(escritor, texto, comprimento);
+        return;
+    }
+    char* destino = csv_iniciar_campo(escritor, csv_reservar(escritor, comprimento + 1));
+    memcpy(destino, texto, comprimento);
+    escritor->usados = (size_t)(destino + comprimento - escritor->buffer);
 }
 
-// Função para exibir o menu de eventos
-void exibir_menu_eventos() {
-    printf("\n===== GERENCIAMENTO DE EVENTOS =====\n");
-    printf("1. Adicionar Evento\n");
-    printf("2. Listar Eventos\n");
-    printf("3. Buscar Evento por ID\n");
-    printf("4. Editar Evento\n");
-    printf("5. Remover Evento\n");
-    printf("6. Ordenar Eventos por Data\n");
-    printf("0. Voltar\n");
-    printf("Escolha uma opção: ");
+// Função para escrever um texto entre aspas, duplicando as aspas internas (RFC 4180)
+void csv_escrever_texto(EscritorCSV* escritor, const char* texto) {
+    size_t comprimento = strlen(texto);
+    
+    // Caso comum: sem aspas internas, o campo é copiado de uma vez
+    if (comprimento + 3 <= CSV_BUFFER_ESCRITA && memchr(texto, '"', comprimento) == NULL) {
+        char* destino = csv_iniciar_campo(escritor, csv_reservar(escritor, comprimento + 3));
+        *destino++ = '"';
+        memcpy(destino, texto, comprimento);
+        destino[comprimento] = '"';
+        escritor->usados = (size_t)(destino + comprimento + 1 - escritor->buffer);
+        return;
+    }
+    
+    if (!escritor->inicio_registro) {
+        csv_escrever_bruto(escritor, ",", 1);
+    }
+    escritor->inicio_registro = false;
+    csv_escrever_bruto(escritor, "\"", 1);
+    const char* aspa;
+    while ((aspa = strchr(texto, '"')) != NULL) {
+        csv_escrever_bruto(escritor, texto, (size_t)(aspa - texto) + 1);
+        csv_escrever_bruto(escritor, "\"", 1);
+        texto = aspa + 1;
+    }
+    csv_escrever_bruto(escritor, texto, strlen(texto));
+    csv_escrever_bruto(escritor, "\"", 1);
 }
 
-// Função para exibir o menu de participantes
-void exibir_menu_participantes() {
-    printf("\n===== GERENCIAMENTO DE PARTICIPANTES =====\n");
-    printf("1. Adicionar Participante\n");
-    printf("2. Listar Participantes\n");
-    printf("3. Buscar Participante por ID\n");
-    printf("4. Editar Participante\n");
-    printf("5. Remover Participante\n");
-    printf("0. Voltar\n");
-    printf("Escolha uma opção: ");
+// Função para terminar o registro atual
+void csv_terminar_registro(EscritorCSV* escritor) {
+    *csv_reservar(escritor, 1) = '\n';
+    escritor->usados++;
+    escritor->inicio_registro = true;
 }
 
-// Função para exibir o menu de inscrições
-void exibir_menu_inscricoes() {
-    printf("\n===== GERENCIAMENTO DE INSCRIÇÕES =====\n");
-    printf("1. Nova Inscrição\n");
-    printf("2. Listar Inscrições por Evento\n");
-    printf("3. Listar Inscrições por Participante\n");
-    printf("4. Cancelar Inscrição\n");
-    printf("0. Voltar\n");
-    printf("Escolha uma opção: ");
+// Função para forçar a gravação em disco do diretório que contém o arquivo (persiste o rename)
+static void csv_sincronizar_diretorio(const char* caminho) {
+#ifndef _WIN32
+    const char* barra = strrchr(caminho, '/');
+    char diretorio[1024] = ".";
+    if (barra != NULL) {
+        size_t comprimento = barra == caminho ? 1 : (size_t)(barra - caminho);
+        if (comprimento >= sizeof(diretorio)) {
+            return;
+        }
+        memcpy(diretorio, caminho, comprimento);
+        diretorio[comprimento] = '\0';
+    }
+    int fd = open(diretorio, O_RDONLY);
+    if (fd >= 0) {
+        fsync(fd);
+        close(fd);
+    }
+#else
+    (void)caminho;
+#endif
 }
 
-// Função para exibir o menu de relatórios
-void exibir_menu_relatorios() {
-    printf("\n===== RELATÓRIOS =====\n");
-    printf("1. Eventos por Categoria\n");
-    printf("2. Eventos com Vagas Disponíveis\n");
-    printf("3. Participantes por Evento\n");
-    printf("4. Estatísticas do Sistema\n");
-    printf("0. Voltar\n");
-    printf("Escolha uma opção: ");
+// Função para concluir a escrita: grava o buffer, sincroniza com o disco e substitui o arquivo
+// final de forma atômica (em caso de falha o arquivo anterior fica intacto); em um arquivo aberto
+// para acréscimo, apenas grava e sincroniza
+bool csv_concluir(EscritorCSV* escritor) {
+    csv_descarregar(escritor);
+    liberar_memoria(escritor->buffer);
+    escritor->buffer = NULL;
+    
+    if (!arquivo_sincronizar(escritor->arquivo)) {
+        escritor->falhou = true;
+    }
+    if (fclose(escritor->arquivo) != 0) {
+        escritor->falhou = true;
+    }
+    
+    if (escritor->temporario == NULL) {
+        if (escritor->falhou) {
+            fprintf(stderr, "Erro ao gravar em %s\n", escritor->caminho);
+        }
+        return !escritor->falhou;
+    }
+    
+    if (!escritor->falhou) {
+#ifdef _WIN32
+        escritor->falhou = !MoveFileExA(escritor->temporario, escritor->caminho,
+                                        MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+#else
+        escritor->falhou = rename(escritor->temporario, escritor->caminho) != 0;
+        if (!escritor->falhou) {
+            csv_sincronizar_diretorio(escritor->caminho);
+        }
+#endif
+    }
+    
+    if (escritor->falhou) {
+        fprintf(stderr, "Erro ao salvar %s: o arquivo anterior foi mantido\n", escritor->caminho);
+        remove(escritor->temporario);
+    }
+    liberar_memoria(escritor->temporario);
+    return !escritor->falhou;
 }
 
-// ====== FUNÇÕES PARA GERENCIAMENTO DE EVENTOS ====== 
+// Função para concluir a escrita em um arquivo aberto por csv_abrir_saida: grava o buffer e o
+// entrega ao sistema, sem sincronizar nem fechar
+bool csv_concluir_saida(EscritorCSV* escritor) {
+    csv_descarregar(escritor);
+    liberar_memoria(escritor->buffer);
+    escritor->buffer = NULL;
+    if (fflush(escritor->arquivo) != 0 || escritor->falhou) {
+        fprintf(stderr, "Erro ao gravar em %s\n", escritor->caminho);
+        return false;
+    }
+    return true;
+}
 
-// Função para processar a adição de um evento
-void adicionar_evento(Evento** lista_eventos, int* proximoIdEvento) {
-    char nome[100], descricao[500], categoria[50], data[11];
-    int capacidade;
+// ====== FUNÇÕES DE PERSISTÊNCIA EM CSV ======
+
+// Salvar eventos em CSV
+void salvar_eventos_csv(TabelaEventos* lista, const char* filename) {
+    EscritorCSV escritor;
+    if (!csv_criar(&escritor, filename)) return;
+    static const char cabecalho[] = "id,nome,descricao,categoria,data,capacidade,vagasDisponiveis\n";
+    csv_escrever_bruto(&escritor, cabecalho, sizeof(cabecalho) - 1);
+    for (int pos = lista->inicio; pos != -1; pos = lista->proximo[pos]) {
+        csv_escrever_inteiro(&escritor, lista->id[pos]);
+        csv_escrever_texto(&escritor, eventos_nome(lista, pos));
+        csv_escrever_texto(&escritor, eventos_descricao(lista, pos));
+        csv_escrever_texto(&escritor, eventos_categoria(lista, pos));
+        csv_escrever_data(&escritor, lista->data[pos]);
+        csv_escrever_inteiro(&escritor, lista->capacidade[pos]);
+        csv_escrever_inteiro(&escritor, lista->vagasDisponiveis[pos]);
+        csv_terminar_registro(&escritor);
+    }
+    csv_concluir(&escritor);
+}
+
+// Salvar participantes em CSV
+void salvar_participantes_csv(TabelaParticipantes* lista, const char* filename) {
+    EscritorCSV escritor;
+    if (!csv_criar(&escritor, filename)) return;
+    static const char cabecalho[] = "id,nome,email,telefone\n";
+    csv_escrever_bruto(&escritor, cabecalho, sizeof(cabecalho) - 1);
+    for (int pos = 0; pos < lista->usados; pos++) {
+        const Participante* atual = &lista->registros[pos];
+        if (!atual->ativo) {
+            continue;
+        }
+        csv_escrever_inteiro(&escritor, atual->id);
+        csv_escrever_texto(&escritor, participantes_nome(lista, pos));
+        csv_escrever_texto(&escritor, participantes_email(lista, pos));
+        csv_escrever_texto(&escritor, participantes_telefone(lista, pos));
+        csv_terminar_registro(&escritor);
+    }
+    csv_concluir(&escritor);
+}
+
+// Salvar inscrições em CSV
+void salvar_inscricoes_csv(ListaInscricoes* lista, TabelaEventos* lista_eventos,
+                           TabelaParticipantes* lista_participantes, const char* filename) {
+    EscritorCSV escritor;
+    if (!csv_criar(&escritor, filename)) return;
+    static const char cabecalho[] = "idParticipante,idEvento,dataInscricao,status\n";
+    csv_escrever_bruto(&escritor, cabecalho, sizeof(cabecalho) - 1);
+    Inscricao* atual = lista->inicio;
+    while (atual) {
+        // Canceladas de eventos ou participantes removidos ficam só para o arquivo morto
+        if (!inscricao_referencias_vivas(lista_eventos, lista_participantes, atual)) {
+            atual = atual->proxima;
+            continue;
+        }
+        csv_escrever_inteiro(&escritor, lista_participantes->registros[atual->participante].id);
+        csv_escrever_inteiro(&escritor, lista_eventos->id[atual->evento]);
+        csv_escrever_simples(&escritor, atual->dataInscricao);
+        csv_escrever_inteiro(&escritor, (int)atual->status);
+        csv_terminar_registro(&escritor);
+        atual = atual->proxima;
+    }
+    csv_concluir(&escritor);
+}
+
+// Arquivar inscrições canceladas: acrescenta-as ao arquivo morto (mesmas colunas de inscricoes.csv)
+// e, só depois de gravadas e sincronizadas, tira-as da memória; devolve quantas foram arquivadas
+// (-1 se a gravação falhou e nada foi descartado)
+int arquivar_inscricoes_canceladas(ListaInscricoes* lista, TabelaEventos* lista_eventos,
+                                   TabelaParticipantes* lista_participantes, const char* filename) {
+    if (lista_inscricoes_canceladas(lista) == 0) {
+        return 0;
+    }
+    EscritorCSV escritor;
+    bool vazio;
+    if (!csv_abrir_acrescimo(&escritor, filename, &vazio)) return -1;
+    if (vazio) {
+        static const char cabecalho[] = "idParticipante,idEvento,dataInscricao,status\n";
+        csv_escrever_bruto(&escritor, cabecalho, sizeof(cabecalho) - 1);
+    }
+    for (Inscricao* atual = lista->inicio; atual != NULL; atual = atual->proxima) {
+        if (atual->status == CANCELADA) {
+            csv_escrever_inteiro(&escritor, lista_participantes->registros[atual->participante].id);
+            csv_escrever_inteiro(&escritor, lista_eventos->id[atual->evento]);
+            csv_escrever_simples(&escritor, atual->dataInscricao);
+            csv_escrever_inteiro(&escritor, (int)atual->status);
+            csv_terminar_registro(&escritor);
+        }
+    }
+    if (!csv_concluir(&escritor)) {
+        return -1;
+    }
+    return lista_inscricoes_descartar_canceladas(lista, lista_eventos, lista_participantes);
+}
+
+// ====== SNAPSHOT BINÁRIO ======
+
+#define ARQUIVO_SNAPSHOT "dados.bin"
+#define SNAPSHOT_VERSAO 2
+#define SNAPSHOT_SECOES 5
+
+// Cabeçalho do snapshot; as seções vêm em seguida, nesta ordem e alinhadas a 8 bytes:
+// textos dos eventos, nomes das categorias, eventos, participantes e inscrições
+typedef struct cabecalho_snapshot {
+    char magica[8];              // "EVSNAP"
+    uint32_t versao;
+    uint32_t ordem_bytes;        // ORDEM_BYTES na ordem de bytes de quem gravou
+    uint32_t eventos;
+    uint32_t categorias;
+    uint32_t participantes;
+    uint32_t inscricoes;
+    uint64_t bytes_textos;       // Tabela de textos dos eventos (deslocamento 0 é a string vazia)
+    uint64_t bytes_categorias;   // Nomes das categorias terminados em '\0', na ordem dos IDs
+    uint64_t lsn;                // Última operação do log já incluída no snapshot
+    uint64_t somas[SNAPSHOT_SECOES];
+    uint64_t soma_cabecalho;     // Soma de todos os campos anteriores
+} CabecalhoSnapshot;
+
+// Registros de tamanho fixo de cada seção
+typedef struct registro_evento {
+    int32_t id;
+    int32_t capacidade;
+    int32_t vagas;
+    uint32_t data;
+    uint32_t nome;               // Deslocamentos na tabela de textos
+    uint32_t descricao;
+    uint32_t categoria;          // ID da categoria
+} RegistroEvento;
+
+typedef struct registro_participante {
+    int32_t id;
+    char nome[PARTICIPANTE_NOME_TAMANHO];
+    char email[PARTICIPANTE_EMAIL_TAMANHO];
+    char telefone[PARTICIPANTE_TELEFONE_TAMANHO];
+} RegistroParticipante;
+
+typedef struct registro_inscricao {
+    uint32_t participante;       // Índice na seção de participantes
+    uint32_t evento;             // Índice na seção de eventos
+    uint32_t data;               // Data compactada AAAAMMDD
+    int32_t status;
+} RegistroInscricao;
+
+// Função para arredondar o tamanho de uma seção para múltiplo de 8 bytes
+static uint64_t snapshot_alinhar(uint64_t bytes) {
+    return (bytes + 7) & ~(uint64_t)7;
+}
+
+// Função para gravar uma seção seguida dos zeros de alinhamento
+static void snapshot_escrever_secao(EscritorCSV* escritor, const void* dados, size_t bytes) {
+    static const char zeros[8] = { 0 };
+    csv_escrever_bruto(escritor, (const char*)dados, bytes);
+    csv_escrever_bruto(escritor, zeros, (size_t)(snapshot_alinhar(bytes) - bytes));
+}
+
+// Função para salvar todos os dados em um snapshot binário
+// (usa o mesmo escritor dos CSVs: arquivo temporário, fsync e rename)
+bool salvar_snapshot(TabelaEventos* eventos, TabelaParticipantes* participantes, ListaInscricoes* inscricoes,
+                     const char* filename, uint64_t lsn) {
+    // Textos dos eventos compactados (sem os descartados do heap), na ordem de exibição
+    HeapTextos textos;
+    heap_textos_iniciar(&textos);
+    RegistroEvento* registros_eventos =
+        (RegistroEvento*)alocar_memoria(((size_t)eventos->tamanho + 1) * sizeof(RegistroEvento));
+    int* indice_por_posicao = (int*)alocar_memoria(((size_t)eventos->usados + 1) * sizeof(int));
+    int n = 0;
+    for (int pos = eventos->inicio; pos != -1; pos = eventos->proximo[pos], n++) {
+        RegistroEvento* r = &registros_eventos[n];
+        r->id = eventos->id[pos];
+        r->capacidade = eventos->capacidade[pos];
+        r->vagas = eventos->vagasDisponiveis[pos];
+        r->data = eventos->data[pos];
+        r->nome = heap_textos_adicionar(&textos, eventos_nome(eventos, pos));
+        r->descricao = heap_textos_adicionar(&textos, eventos_descricao(eventos, pos));
+        r->categoria = (uint32_t)eventos->categoria[pos];
+        indice_por_posicao[pos] = n;
+    }
     
-    printf("\n== Adicionar Novo Evento ==\n");
+    size_t bytes_categorias = 0;
+    for (int c = 0; c < eventos->categorias.quantidade; c++) {
+        bytes_categorias += strlen(eventos->categorias.categorias[c].nome) + 1;
+    }
+    char* nomes_categorias = (char*)alocar_memoria(bytes_categorias + 1);
+    size_t deslocamento = 0;
+    for (int c = 0; c < eventos->categorias.quantidade; c++) {
+        size_t comprimento = strlen(eventos->categorias.categorias[c].nome) + 1;
+        memcpy(nomes_categorias + deslocamento, eventos->categorias.categorias[c].nome, comprimento);
+        deslocamento += comprimento;
+    }
     
-    printf("Nome do evento: ");
-    scanf(" %[^\n]", nome);
+    // Participantes na ordem das posições; o índice de cada posição serve às inscrições
+    RegistroParticipante* registros_participantes =
+        (RegistroParticipante*)alocar_memoria(((size_t)participantes->tamanho + 1) * sizeof(RegistroParticipante));
+    int* participante_por_posicao = (int*)alocar_memoria(((size_t)participantes->usados + 1) * sizeof(int));
+    int k = 0;
+    for (int pos = 0; pos < participantes->usados; pos++) {
+        const Participante* atual = &participantes->registros[pos];
+        if (!atual->ativo) {
+            continue;
+        }
+        RegistroParticipante* r = &registros_participantes[k];
+        memset(r, 0, sizeof(*r));
+        r->id = atual->id;
+        // Os textos do heap já cabem nos campos fixos do registro (truncados ao serem guardados)
+        strcpy(r->nome, participantes_nome(participantes, pos));
+        strcpy(r->email, participantes_email(participantes, pos));
+        strcpy(r->telefone, participantes_telefone(participantes, pos));
+        participante_por_posicao[pos] = k++;
+    }
     
-    printf("Descrição: ");
-    scanf(" %[^\n]", descricao);
+    RegistroInscricao* registros_inscricoes =
+        (RegistroInscricao*)alocar_memoria(((size_t)inscricoes->tamanho + 1) * sizeof(RegistroInscricao));
+    int total_inscricoes = 0;
+    for (Inscricao* i = inscricoes->inicio; i != NULL; i = i->proxima) {
+        if (!inscricao_referencias_vivas(eventos, participantes, i)) {
+            continue;
+        }
+        RegistroInscricao* r = &registros_inscricoes[total_inscricoes++];
+        r->participante = (uint32_t)participante_por_posicao[i->participante];
+        r->evento = (uint32_t)indice_por_posicao[i->evento];
+        r->data = data_compactar_estrita(i->dataInscricao, strlen(i->dataInscricao));
+        r->status = (int32_t)i->status;
+    }
     
-    printf("Categoria: ");
-    scanf(" %[^\n]", categoria);
+    // Cabeçalho com as somas de todas as seções
+    const void* secoes[SNAPSHOT_SECOES] = {
+        textos.dados, nomes_categorias, registros_eventos, registros_participantes, registros_inscricoes
+    };
+    size_t bytes[SNAPSHOT_SECOES] = {
+        textos.tamanho, bytes_categorias, (size_t)n * sizeof(RegistroEvento),
+        (size_t)participantes->tamanho * sizeof(RegistroParticipante),
+        (size_t)total_inscricoes * sizeof(RegistroInscricao)
+    };
     
-    printf("Data (YYYY-MM-DD): ");
-    scanf(" %10s", data);
+    CabecalhoSnapshot cabecalho;
+    memset(&cabecalho, 0, sizeof(cabecalho));
+    memcpy(cabecalho.magica, "EVSNAP", 6);
+    cabecalho.versao = SNAPSHOT_VERSAO;
+    cabecalho.ordem_bytes = ORDEM_BYTES;
+    cabecalho.eventos = (uint32_t)n;
+    cabecalho.categorias = (uint32_t)eventos->categorias.quantidade;
+    cabecalho.participantes = (uint32_t)participantes->tamanho;
+    cabecalho.inscricoes = (uint32_t)total_inscricoes;
+    cabecalho.bytes_textos = textos.tamanho;
+    cabecalho.bytes_categorias = bytes_categorias;
+    cabecalho.lsn = lsn;
+    for (int s = 0; s < SNAPSHOT_SECOES; s++) {
+        cabecalho.somas[s] = soma_verificacao(secoes[s], bytes[s]);
+    }
+    cabecalho.soma_cabecalho = soma_verificacao(&cabecalho, offsetof(CabecalhoSnapshot, soma_cabecalho));
     
-    printf("Capacidade: ");
-    scanf("%d", &capacidade);
+    EscritorCSV escritor;
+    bool ok = csv_criar(&escritor, filename);
+    if (ok) {
+        csv_escrever_bruto(&escritor, (const char*)&cabecalho, sizeof(cabecalho));
+        for (int s = 0; s < SNAPSHOT_SECOES; s++) {
+            snapshot_escrever_secao(&escritor, secoes[s], bytes[s]);
+        }
+        ok = csv_concluir(&escritor);
+    }
+    
+    heap_textos_liberar(&textos);
+    liberar_memoria(participante_por_posicao);
+    liberar_memoria(registros_eventos);
+    liberar_memoria(indice_por_posicao);
+    liberar_memoria(nomes_categorias);
+    liberar_memoria(registros_participantes);
+    liberar_memoria(registros_inscricoes);
+    return ok;
+}
+
+// Função para ler um arquivo inteiro para a memória (NULL se não existir ou não puder ser lido)
+static char* snapshot_ler_arquivo(const char* filename, size_t* tamanho) {
+    FILE* f = fopen(filename, "rb");
+    if (f == NULL) {
+        return NULL;
+    }
+    
+    char* dados = NULL;
+    long bytes = -1;
+    if (fseek(f, 0, SEEK_END) == 0) {
+        bytes = ftell(f);
+    }
+    if (bytes >= 0 && fseek(f, 0, SEEK_SET) == 0) {
+        dados = (char*)alocar_memoria((size_t)bytes + 1);
+        if (fread(dados, 1, (size_t)bytes, f) != (size_t)bytes) {
+            liberar_memoria(dados);
+            dados = NULL;
+        }
+    }
+    fclose(f);
+    *tamanho = (size_t)bytes;
+    return dados;
+}
+
+// Função para mapear o snapshot na memória, só para leitura: as seções são lidas no próprio
+// mapeamento, sem uma cópia do arquivo inteiro (fora do POSIX, o arquivo é lido para a memória).
+// NULL se não existir ou não puder ser lido; liberado por snapshot_desmapear
+static const char* snapshot_mapear(const char* filename, size_t* tamanho) {
+#ifndef _WIN32
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat info;
+    void* dados = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        dados = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (dados == MAP_FAILED) {
+        return NULL;
+    }
+    posix_madvise(dados, (size_t)info.st_size, POSIX_MADV_SEQUENTIAL);
+    *tamanho = (size_t)info.st_size;
+    return (const char*)dados;
+#else
+    return snapshot_ler_arquivo(filename, tamanho);
+#endif
+}
+
+// Função para desfazer o mapeamento de snapshot_mapear
+static void snapshot_desmapear(const char* dados, size_t tamanho) {
+#ifndef _WIN32
+    munmap((void*)dados, tamanho);
+#else
+    (void)tamanho;
+    liberar_memoria((void*)dados);
+#endif
+}
+
+// Função para validar o cabeçalho, o tamanho, as somas e as referências internas do snapshot
+// (nada é carregado se algo estiver errado)
+static bool snapshot_validar(const char* dados, size_t tamanho, CabecalhoSnapshot* cabecalho,
+                             const char** secoes) {
+    if (tamanho < sizeof(CabecalhoSnapshot)) {
+        return false;
+    }
+    memcpy(cabecalho, dados, sizeof(CabecalhoSnapshot));
+    if (memcmp(cabecalho->magica, "EVSNAP", 6) != 0 || cabecalho->versao != SNAPSHOT_VERSAO ||
+        cabecalho->ordem_bytes != ORDEM_BYTES ||
+        cabecalho->soma_cabecalho != soma_verificacao(cabecalho, offsetof(CabecalhoSnapshot, soma_cabecalho))) {
+        return false;
+    }
+    
+    uint64_t bytes[SNAPSHOT_SECOES] = {
+        cabecalho->bytes_textos, cabecalho->bytes_categorias,
+        (uint64_t)cabecalho->eventos * sizeof(RegistroEvento),
+        (uint64_t)cabecalho->participantes * sizeof(RegistroParticipante),
+        (uint64_t)cabecalho->inscricoes * sizeof(RegistroInscricao)
+    };
+    uint64_t deslocamento = sizeof(CabecalhoSnapshot);
+    for (int s = 0; s < SNAPSHOT_SECOES; s++) {
+        if (bytes[s] > tamanho || deslocamento + snapshot_alinhar(bytes[s]) > tamanho ||
+            cabecalho->somas[s] != soma_verificacao(dados + deslocamento, (size_t)bytes[s])) {
+            return false;
+        }
+        secoes[s] = dados + deslocamento;
+        deslocamento += snapshot_alinhar(bytes[s]);
+    }
+    if (deslocamento != tamanho) {
+        return false;
+    }
+    
+    // Textos: começam pela string vazia e terminam em '\0'; categorias: exatamente uma string por ID
+    const char* textos = secoes[0];
+    if (cabecalho->bytes_textos == 0 || textos[0] != '\0' || textos[cabecalho->bytes_textos - 1] != '\0' ||
+        cabecalho->bytes_textos > UINT32_MAX) {
+        return false;
+    }
+    uint32_t terminadores = 0;
+    for (uint64_t i = 0; i < cabecalho->bytes_categorias; i++) {
+        terminadores += secoes[1][i] == '\0';
+    }
+    if (terminadores != cabecalho->categorias ||
+        (cabecalho->bytes_categorias > 0 && secoes[1][cabecalho->bytes_categorias - 1] != '\0')) {
+        return false;
+    }
+    
+    for (uint32_t k = 0; k < cabecalho->eventos; k++) {
+        RegistroEvento r;
+        memcpy(&r, secoes[2] + (size_t)k * sizeof(r), sizeof(r));
+        if (r.nome >= cabecalho->bytes_textos || r.descricao >= cabecalho->bytes_textos ||
+            r.categoria >= cabecalho->categorias || r.vagas > r.capacidade) {
+            return false;
+        }
+    }
+    for (uint32_t k = 0; k < cabecalho->inscricoes; k++) {
+        RegistroInscricao r;
+        memcpy(&r, secoes[4] + (size_t)k * sizeof(r), sizeof(r));
+        if (r.participante >= cabecalho->participantes || r.evento >= cabecalho->eventos ||
+            r.status < CONFIRMADA || r.status > CANCELADA || r.data == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Função para carregar um snapshot binário em estruturas vazias (false se ausente ou inválido)
+bool carregar_snapshot(TabelaEventos* eventos, TabelaParticipantes* participantes, ListaInscricoes* inscricoes,
+                       const char* filename, int* proximoIdEvento, int* proximoIdParticipante, uint64_t* lsn) {
+    size_t tamanho;
+    const char* dados = snapshot_mapear(filename, &tamanho);
+    if (dados == NULL) {
+        return false;
+    }
     
-    Evento* novo = evento_criar(*proximoIdEvento, nome, descricao, categoria, data, capacidade);
-    *lista_eventos = eventos_adicionar(*lista_eventos, novo);
+    CabecalhoSnapshot cabecalho;
+    const char* secoes[SNAPSHOT_SECOES];
+    if (!snapshot_validar(dados, tamanho, &cabecalho, secoes)) {
+        fprintf(stderr, "Snapshot %s inválido ou corrompido: usando os arquivos CSV\n", filename);
+        snapshot_desmapear(dados, tamanho);
+        return false;
+    }
     
-    (*proximoIdEvento)++;
+    // A tabela de textos do snapshot passa a ser o heap de textos da tabela de eventos
+    heap_textos_liberar(&eventos->textos);
+    eventos->textos.dados = (char*)alocar_memoria((size_t)cabecalho.bytes_textos);
+    memcpy(eventos->textos.dados, secoes[0], (size_t)cabecalho.bytes_textos);
+    eventos->textos.tamanho = (size_t)cabecalho.bytes_textos;
+    eventos->textos.capacidade = (size_t)cabecalho.bytes_textos;
+    eventos->textos.desperdicio = 0;
     
-    printf("\nEvento adicionado com sucesso! ID: %d\n", novo->id);
-}
-
-// Função para buscar e exibir um evento por ID
-void buscar_evento(Evento* lista_eventos) {
-    int id;
+    // Categorias na ordem dos IDs gravados
+    int* categorias = (int*)alocar_memoria(((size_t)cabecalho.categorias + 1) * sizeof(int));
+    const char* nome = secoes[1];
+    for (uint32_t c = 0; c < cabecalho.categorias; c++) {
+        categorias[c] = indice_categorias_internar(&eventos->categorias, nome);
+        nome += strlen(nome) + 1;
+    }
     
-    printf("\n== Buscar Evento por ID ==\n");
-    printf("ID do evento: ");
-    scanf("%d", &id);
+    // Eventos já na ordem de exibição; a ordenação final só reconstrói o índice de datas
+    int* posicoes = (int*)alocar_memoria(((size_t)cabecalho.eventos + 1) * sizeof(int));
+    indice_reservar(&eventos->indice, cabecalho.eventos);
+    for (uint32_t k = 0; k < cabecalho.eventos; k++) {
+        RegistroEvento r;
+        memcpy(&r, secoes[2] + (size_t)k * sizeof(r), sizeof(r));
+        posicoes[k] = eventos_restaurar_no_fim(eventos, r.id, r.nome, r.descricao, categorias[r.categoria],
+                                               r.data, r.capacidade, r.vagas);
+        if (r.id >= *proximoIdEvento) *proximoIdEvento = r.id + 1;
+    }
+    ordenar_eventos_por_data(eventos, contar_eventos(eventos));
     
-    Evento* evento = eventos_buscar_por_id(lista_eventos, id);
+    int* posicoes_participantes = (int*)alocar_memoria(((size_t)cabecalho.participantes + 1) * sizeof(int));
+    participantes_reservar(participantes, cabecalho.participantes);
+    for (uint32_t k = 0; k < cabecalho.participantes; k++) {
+        RegistroParticipante r;
+        memcpy(&r, secoes[3] + (size_t)k * sizeof(r), sizeof(r));
+        r.nome[sizeof(r.nome) - 1] = '\0';
+        r.email[sizeof(r.email) - 1] = '\0';
+        r.telefone[sizeof(r.telefone) - 1] = '\0';
+        posicoes_participantes[k] = participantes_restaurar(participantes, r.id, r.nome, r.email, r.telefone);
+        if (r.id >= *proximoIdParticipante) *proximoIdParticipante = r.id + 1;
+    }
     
-    if (evento != NULL) {
-        printf("\n=== EVENTO ENCONTRADO ===\n");
-        printf("ID: %d\n", evento->id);
-        printf("Nome: %s\n", evento->nome);
-        printf("Descrição: %s\n", evento->descricao);
-        printf("Categoria: %s\n", evento->categoria);
-        printf("Data: %s\n", evento->data);
-        printf("Capacidade: %d\n", evento->capacidade);
-        printf("Vagas disponíveis: %d\n", evento->vagasDisponiveis);
-    } else {
-        printf("\nEvento não encontrado!\n");
+    // Inscrições resolvidas por índice, sem nenhuma busca: os nós são criados em sequência e
+    // encadeados todos de uma vez
+    char data[11];
+    Inscricao** novas = (Inscricao**)alocar_memoria(((size_t)cabecalho.inscricoes + 1) * sizeof(Inscricao*));
+    for (uint32_t k = 0; k < cabecalho.inscricoes; k++) {
+        RegistroInscricao r;
+        memcpy(&r, secoes[4] + (size_t)k * sizeof(r), sizeof(r));
+        data_formatar(r.data, data);
+        novas[k] = inscricao_criar(posicoes_participantes[r.participante], posicoes[r.evento], data,
+                                   (StatusInscricao)r.status);
+    }
+    lista_inscricoes_adicionar_em_lote(inscricoes, eventos, participantes, novas, (int)cabecalho.inscricoes);
+    liberar_memoria(novas);
+    
+    *lsn = cabecalho.lsn;
+    liberar_memoria(categorias);
+    liberar_memoria(posicoes);
+    liberar_memoria(posicoes_participantes);
+    snapshot_desmapear(dados, tamanho);
+    return true;
+}
+
+// Função para verificar se o snapshot existe e é tão recente quanto os arquivos CSV
+// (CSVs editados à mão depois do último salvamento têm prioridade)
+bool snapshot_atualizado(const char* snapshot, const char* const* csvs, int quantidade) {
+    struct stat info;
+    if (stat(snapshot, &info) != 0) {
+        return false;
+    }
+    time_t gravado = info.st_mtime;
+    for (int k = 0; k < quantidade; k++) {
+        if (stat(csvs[k], &info) == 0 && info.st_mtime > gravado) {
+            return false;
+        }
     }
+    return true;
 }
 
-// Função para editar um evento
-void editar_evento(Evento* lista_eventos) {
+// ====== CARGA PARALELA DOS CSVs ======
+
+#define CARGA_BLOCO_MINIMO (1 << 22)   // Trechos menores não compensam uma tarefa própria
+#define CARGA_BLOCOS_POR_TAREFA 4      // Blocos a mais equilibram os que demoram mais
+
+typedef enum {
+    CARGA_EVENTOS,
+    CARGA_PARTICIPANTES,
+    CARGA_INSCRICOES
+} TipoCarga;
+
+// Linha de eventos.csv já convertida (os textos apontam para o conteúdo do arquivo)
+typedef struct carga_evento {
+    long linha;
+    const char* nome;
+    const char* descricao;
+    const char* categoria;
     int id;
+    int capacidade;
+    int vagas;
+    int coluna_vagas;        // Para o erro de vagas, verificado depois do ID repetido
+    uint32_t data;
+    bool erro;               // A mensagem está no relatório do bloco
+} CargaEvento;
+
+// Linha de participantes.csv já convertida
+typedef struct carga_participante {
+    long linha;
+    const char* nome;
+    const char* email;
+    const char* telefone;
+    int id;
+    bool erro;
+} CargaParticipante;
+
+// Linha de inscricoes.csv já convertida; participante e evento são resolvidos depois
+typedef struct carga_inscricao {
+    long linha;
+    const char* data;
+    int participante;
+    int idParticipante;
+    int idEvento;
+    int evento;
+    int coluna_evento;       // Para o erro de evento inexistente
+    StatusInscricao status;
+    bool erro;
+} CargaInscricao;
+
+struct arquivo_carga;
+
+// Trecho de linhas inteiras de um arquivo, convertido por uma tarefa em registros próprios
+typedef struct bloco_carga {
+    struct arquivo_carga* arquivo;
+    size_t inicio;
+    size_t fim;
+    long primeira_linha;
+    size_t aspas;            // Aspas e quebras de linha do trecho bruto, antes do ajuste às linhas
+    size_t quebras;
+    void* registros;         // CargaEvento, CargaParticipante ou CargaInscricao, conforme o arquivo
+    int quantidade;
+    int alocados;
+    BufferBytes relatorio;   // Mensagens de erro do bloco, na ordem das linhas, cada uma terminada em '\0'
+} BlocoCarga;
+
+// Arquivo em carga: o conteúdo fica inteiro na memória até ser integrado às estruturas
+typedef struct arquivo_carga {
+    TipoCarga tipo;
+    const char* nome;
+    char* conteudo;
+    size_t tamanho;
+    BlocoCarga* blocos;
+    int quantidade_blocos;
+    BufferBytes relatorio;   // Mensagens de erro do arquivo, exibidas ao fim da carga
+    TabelaEventos* eventos;
+    TabelaParticipantes* participantes;
+    ListaInscricoes* inscricoes;
+    int* proximoId;
+} ArquivoCarga;
+
+// Função para ler um arquivo inteiro para a memória (arquivo ausente fica sem blocos)
+static void carga_ler_arquivo(void* argumento) {
+    ArquivoCarga* arquivo = (ArquivoCarga*)argumento;
+    arquivo->conteudo = snapshot_ler_arquivo(arquivo->nome, &arquivo->tamanho);
+    if (arquivo->conteudo == NULL) {
+        arquivo->tamanho = 0;
+    }
+}
+
+// Função para dividir o conteúdo em trechos brutos de tamanhos parecidos
+// (as fronteiras são levadas para o início de uma linha depois da contagem)
+static void carga_dividir(ArquivoCarga* arquivo, int tarefas) {
+    arquivo->quantidade_blocos = 0;
+    arquivo->blocos = NULL;
+    if (arquivo->conteudo == NULL) {
+        return;
+    }
     
-    printf("\n== Editar Evento ==\n");
-    printf("ID do evento a ser editado: ");
-    scanf("%d", &id);
-    
-    Evento* evento = eventos_buscar_por_id(lista_eventos, id);
+    // Ignorar a marca de ordem de bytes do UTF-8, se houver
+    size_t inicio = arquivo->tamanho >= 3 && memcmp(arquivo->conteudo, "\xEF\xBB\xBF", 3) == 0 ? 3 : 0;
+    size_t util = arquivo->tamanho - inicio;
+    size_t quantidade = (size_t)tarefas * CARGA_BLOCOS_POR_TAREFA;
+    if (quantidade > util / CARGA_BLOCO_MINIMO) {
+        quantidade = util / CARGA_BLOCO_MINIMO;
+    }
+    if (quantidade < 1) {
+        quantidade = 1;
+    }
     
-    if (evento != NULL) {
-        printf("\n=== EDITANDO EVENTO ===\n");
-        printf("Nome atual: %s\n", evento->nome);
-        printf("Novo nome (ou pressione Enter para manter): ");
-        char nome[100];
-        getchar(); // Limpar o buffer
-        fgets(nome, sizeof(nome), stdin);
-        if (nome[0] != '\n') {
-            nome[strcspn(nome, "\n")] = 0; // Remover o \n do final
-            strncpy(evento->nome, nome, sizeof(evento->nome)-1);
+    arquivo->blocos = (BlocoCarga*)alocar_memoria(quantidade * sizeof(BlocoCarga));
+    arquivo->quantidade_blocos = (int)quantidade;
+    for (size_t k = 0; k < quantidade; k++) {
+        BlocoCarga* bloco = &arquivo->blocos[k];
+        bloco->arquivo = arquivo;
+        bloco->inicio = inicio + util * k / quantidade;
+        bloco->fim = inicio + util * (k + 1) / quantidade;
+        bloco->primeira_linha = 1;
+        bloco->registros = NULL;
+        bloco->quantidade = 0;
+        bloco->alocados = 0;
+        memset(&bloco->relatorio, 0, sizeof(BufferBytes));
+    }
+}
+
+// Função para contar as aspas e as quebras de linha do trecho bruto de um bloco
+static void carga_contar_trecho(void* argumento) {
+    BlocoCarga* bloco = (BlocoCarga*)argumento;
+    const char* dados = bloco->arquivo->conteudo;
+    size_t aspas = 0;
+    size_t quebras = 0;
+    for (size_t k = bloco->inicio; k < bloco->fim; k++) {
+        aspas += dados[k] == '"';
+        quebras += dados[k] == '\n';
+    }
+    bloco->aspas = aspas;
+    bloco->quebras = quebras;
+}
+
+// Função para levar o início de cada bloco para depois da primeira quebra de linha fora de aspas
+// e calcular a linha em que ele começa: a paridade das aspas anteriores diz se o trecho bruto
+// começa dentro de um campo entre aspas (o leitor alterna o estado a cada aspa)
+static void carga_ajustar_fronteiras(ArquivoCarga* arquivo) {
+    size_t aspas = 0;        // Totais dos trechos brutos anteriores
+    size_t quebras = 0;
+    for (int k = 0; k < arquivo->quantidade_blocos; k++) {
+        BlocoCarga* bloco = &arquivo->blocos[k];
+        if (k > 0) {
+            bool entre_aspas = aspas % 2 == 1;
+            size_t pos = bloco->inicio;
+            size_t puladas = 0;
+            while (pos < arquivo->tamanho) {
+                char c = arquivo->conteudo[pos++];
+                if (c == '"') {
+                    entre_aspas = !entre_aspas;
+                } else if (c == '\n') {
+                    puladas++;
+                    if (!entre_aspas) {
+                        break;
+                    }
+                }
+            }
+            // Um campo entre aspas longo pode cobrir trechos inteiros, que ficam vazios
+            bloco->inicio = pos;
+            bloco->primeira_linha = (long)(1 + quebras + puladas);
+            arquivo->blocos[k - 1].fim = pos;
         }
-        
-        printf("Descrição atual: %s\n", evento->descricao);
-        printf("Nova descrição (ou pressione Enter para manter): ");
-        char descricao[500];
-        fgets(descricao, sizeof(descricao), stdin);
-        if (descricao[0] != '\n') {
-            descricao[strcspn(descricao, "\n")] = 0;
-            strncpy(evento->descricao, descricao, sizeof(evento->descricao)-1);
+        aspas += bloco->aspas;
+        quebras += bloco->quebras;
+    }
+}
+
+// Função para obter espaço para mais um registro convertido no bloco
+static void* carga_novo_registro(BlocoCarga* bloco, size_t tamanho_item) {
+    if (bloco->quantidade == bloco->alocados) {
+        // A quantidade de quebras do trecho bruto já é uma boa estimativa da quantidade de linhas
+        bloco->alocados = bloco->alocados == 0 ? (int)bloco->quebras + 16 : bloco->alocados * 2;
+        bloco->registros = coluna_redimensionar(bloco->registros, (size_t)bloco->alocados, tamanho_item);
+    }
+    return (char*)bloco->registros + (size_t)bloco->quantidade++ * tamanho_item;
+}
+
+// Função para acrescentar uma mensagem de erro a um relatório (com '\0' no fim, se pedido)
+static void carga_anotar_erro(BufferBytes* relatorio, const char* filename, long linha, int coluna,
+                              const char* mensagem, bool terminar) {
+    char texto[512];
+    int tamanho = csv_formatar_erro(texto, sizeof(texto), filename, linha, coluna, mensagem);
+    if (tamanho >= (int)sizeof(texto)) {
+        tamanho = (int)sizeof(texto) - 1;
+    }
+    buffer_acrescentar(relatorio, texto, (size_t)tamanho + (terminar ? 1 : 0));
+}
+
+// Função para repassar ao relatório do arquivo a próxima mensagem guardada no bloco
+// (devolve a mensagem seguinte)
+static const char* carga_repassar_erro(ArquivoCarga* arquivo, const char* mensagem) {
+    size_t tamanho = strlen(mensagem);
+    buffer_acrescentar(&arquivo->relatorio, mensagem, tamanho);
+    return mensagem + tamanho + 1;
+}
+
+// Função para converter as linhas de um bloco, com as mesmas validações da leitura sequencial;
+// o que depende de outras linhas (IDs repetidos, referências) fica para a integração
+static void carga_converter_bloco(void* argumento) {
+    BlocoCarga* bloco = (BlocoCarga*)argumento;
+    ArquivoCarga* arquivo = bloco->arquivo;
+    LeitorCSV leitor;
+    csv_abrir_memoria(&leitor, arquivo->nome, arquivo->conteudo + bloco->inicio, bloco->fim - bloco->inicio,
+                      bloco->primeira_linha);
+    if (bloco == arquivo->blocos) {
+        csv_proximo_registro(&leitor); // header
+    }
+    
+    int resultado;
+    while ((resultado = csv_proximo_registro(&leitor)) != 0) {
+        bool valido = resultado > 0;
+        bool* erro;
+        if (arquivo->tipo == CARGA_EVENTOS) {
+            CargaEvento* e = (CargaEvento*)carga_novo_registro(bloco, sizeof(CargaEvento));
+            valido = valido && csv_verificar_campos(&leitor, 7) &&
+                     csv_campo_inteiro(&leitor, 0, &e->id) && csv_campo_data(&leitor, 4, &e->data) &&
+                     csv_campo_inteiro(&leitor, 5, &e->capacidade) && csv_campo_inteiro(&leitor, 6, &e->vagas);
+            if (valido) {
+                e->nome = leitor.campos[1];
+                e->descricao = leitor.campos[2];
+                e->categoria = leitor.campos[3];
+                e->coluna_vagas = leitor.colunas[6];
+            }
+            e->linha = leitor.linha;
+            erro = &e->erro;
+        } else if (arquivo->tipo == CARGA_PARTICIPANTES) {
+            CargaParticipante* p = (CargaParticipante*)carga_novo_registro(bloco, sizeof(CargaParticipante));
+            valido = valido && csv_verificar_campos(&leitor, 4) && csv_campo_inteiro(&leitor, 0, &p->id) &&
+                     csv_campo_texto(&leitor, 1, PARTICIPANTE_NOME_TAMANHO) &&
+                     csv_campo_texto(&leitor, 2, PARTICIPANTE_EMAIL_TAMANHO) &&
+                     csv_campo_texto(&leitor, 3, PARTICIPANTE_TELEFONE_TAMANHO);
+            if (valido) {
+                p->nome = leitor.campos[1];
+                p->email = leitor.campos[2];
+                p->telefone = leitor.campos[3];
+            }
+            p->linha = leitor.linha;
+            erro = &p->erro;
+        } else {
+            CargaInscricao* i = (CargaInscricao*)carga_novo_registro(bloco, sizeof(CargaInscricao));
+            int status;
+            uint32_t data;
+            valido = valido && csv_verificar_campos(&leitor, 4) &&
+                     csv_campo_inteiro(&leitor, 0, &i->idParticipante) &&
+                     csv_campo_inteiro(&leitor, 1, &i->idEvento) && csv_campo_data(&leitor, 2, &data) &&
+                     csv_campo_inteiro(&leitor, 3, &status);
+            if (valido && (status < CONFIRMADA || status > CANCELADA)) {
+                valido = csv_registrar_erro(&leitor, 3, "status de inscrição inválido");
+            }
+            if (valido) {
+                i->data = leitor.campos[2];
+                i->status = (StatusInscricao)status;
+                i->coluna_evento = leitor.colunas[1];
+            }
+            i->linha = leitor.linha;
+            erro = &i->erro;
         }
         
-        printf("Categoria atual: %s\n", evento->categoria);
-        printf("Nova categoria (ou pressione Enter para manter): ");
-        char categoria[50];
-        fgets(categoria, sizeof(categoria), stdin);
-        if (categoria[0] != '\n') {
-            categoria[strcspn(categoria, "\n")] = 0;
-            strncpy(evento->categoria, categoria, sizeof(evento->categoria)-1);
+        *erro = !valido;
+        if (!valido) {
+            carga_anotar_erro(&bloco->relatorio, leitor.nome_arquivo, leitor.linha, leitor.erro_coluna,
+                              leitor.erro, true);
         }
-        
-        printf("Data atual: %s\n", evento->data);
-        printf("Nova data (YYYY-MM-DD) (ou pressione Enter para manter): ");
-        char data[11];
-        fgets(data, sizeof(data), stdin);
-        if (data[0] != '\n') {
-            data[strcspn(data, "\n")] = 0;
-            strncpy(evento->data, data, sizeof(evento->data)-1);
+    }
+}
+
+// Função para resolver participante e evento das inscrições de um bloco (somente consultas aos
+// índices, que já estão completos); as mensagens do bloco são refeitas na ordem das linhas
+static void carga_resolver_bloco(void* argumento) {
+    BlocoCarga* bloco = (BlocoCarga*)argumento;
+    ArquivoCarga* arquivo = bloco->arquivo;
+    CargaInscricao* registros = (CargaInscricao*)bloco->registros;
+    BufferBytes relatorio = { NULL, 0, 0 };
+    const char* mensagem = bloco->relatorio.dados;
+    
+    for (int k = 0; k < bloco->quantidade; k++) {
+        CargaInscricao* i = &registros[k];
+        if (i->erro) {
+            size_t tamanho = strlen(mensagem) + 1;
+            buffer_acrescentar(&relatorio, mensagem, tamanho);
+            mensagem += tamanho;
+            continue;
         }
-        
-        printf("Capacidade atual: %d\n", evento->capacidade);
-        printf("Nova capacidade (ou digite 0 para manter): ");
-        int capacidade;
-        scanf("%d", &capacidade);
-        if (capacidade > 0) {
-            int diferenca = capacidade - evento->capacidade;
-            evento->capacidade = capacidade;
-            evento->vagasDisponiveis += diferenca;
-            if (evento->vagasDisponiveis < 0) {
-                evento->vagasDisponiveis = 0;
-            }
+        i->participante = participantes_buscar_por_id(arquivo->participantes, i->idParticipante);
+        i->evento = eventos_buscar_por_id(arquivo->eventos, i->idEvento);
+        if (i->participante == -1 || i->evento == -1) {
+            i->erro = true;
+            carga_anotar_erro(&relatorio, arquivo->nome, i->linha, i->participante == -1 ? 1 : i->coluna_evento,
+                              i->participante == -1 ? "participante inexistente" : "evento inexistente", true);
         }
-        
-        printf("\nEvento atualizado com sucesso!\n");
-    } else {
-        printf("\nEvento não encontrado!\n");
     }
+    
+    liberar_memoria(bloco->relatorio.dados);
+    bloco->relatorio = relatorio;
 }
 
-// Função para remover um evento
-void remover_evento(Evento** lista_eventos) {
-    int id;
-    
-    printf("\n== Remover Evento ==\n");
-    printf("ID do evento a ser removido: ");
-    scanf("%d", &id);
+// Função para integrar às estruturas os registros de todos os blocos de um arquivo, na ordem do
+// arquivo (um arquivo por tarefa: eventos e participantes não compartilham estado)
+static void carga_integrar(void* argumento) {
+    ArquivoCarga* arquivo = (ArquivoCarga*)argumento;
+    size_t total = 0;
+    for (int b = 0; b < arquivo->quantidade_blocos; b++) {
+        total += (size_t)arquivo->blocos[b].quantidade;
+    }
+    if (arquivo->tipo == CARGA_PARTICIPANTES) {
+        participantes_reservar(arquivo->participantes, total);
+        // Os textos guardados nunca passam do tamanho do próprio arquivo
+        heap_textos_reservar(&arquivo->participantes->textos, arquivo->tamanho);
+    } else if (arquivo->tipo == CARGA_INSCRICOES) {
+        indice_reservar(&arquivo->inscricoes->indice, total);
+    }
     
-    Evento* evento = eventos_buscar_por_id(*lista_eventos, id);
+    for (int b = 0; b < arquivo->quantidade_blocos; b++) {
+        BlocoCarga* bloco = &arquivo->blocos[b];
+        const char* mensagem = bloco->relatorio.dados;
+        for (int k = 0; k < bloco->quantidade; k++) {
+            if (arquivo->tipo == CARGA_EVENTOS) {
+                CargaEvento* e = &((CargaEvento*)bloco->registros)[k];
+                if (e->erro) {
+                    mensagem = carga_repassar_erro(arquivo, mensagem);
+                } else if (eventos_buscar_por_id(arquivo->eventos, e->id) != -1) {
+                    carga_anotar_erro(&arquivo->relatorio, arquivo->nome, e->linha, 1, "ID de evento repetido", false);
+                } else if (e->vagas > e->capacidade) {
+                    // Vagas negativas são válidas: capacidade reduzida abaixo das confirmadas
+                    carga_anotar_erro(&arquivo->relatorio, arquivo->nome, e->linha, e->coluna_vagas,
+                                      "vagas acima da capacidade", false);
+                } else {
+                    // Os textos são copiados direto do conteúdo do arquivo para o heap da tabela
+                    int pos = eventos_adicionar_no_fim(arquivo->eventos, e->id, e->nome, e->descricao,
+                                                       e->categoria, e->data, e->capacidade);
+                    eventos_ajustar_vagas(arquivo->eventos, pos, e->vagas - e->capacidade);
+                    if (e->id >= *arquivo->proximoId) *arquivo->proximoId = e->id + 1;
+                }
+            } else if (arquivo->tipo == CARGA_PARTICIPANTES) {
+                CargaParticipante* p = &((CargaParticipante*)bloco->registros)[k];
+                if (p->erro) {
+                    mensagem = carga_repassar_erro(arquivo, mensagem);
+                } else if (participantes_buscar_por_id(arquivo->participantes, p->id) != -1) {
+                    carga_anotar_erro(&arquivo->relatorio, arquivo->nome, p->linha, 1,
+                                      "ID de participante repetido", false);
+                } else {
+                    participantes_restaurar(arquivo->participantes, p->id, p->nome, p->email, p->telefone);
+                    if (p->id >= *arquivo->proximoId) *arquivo->proximoId = p->id + 1;
+                }
+            } else {
+                CargaInscricao* i = &((CargaInscricao*)bloco->registros)[k];
+                if (i->erro) {
+                    mensagem = carga_repassar_erro(arquivo, mensagem);
+                } else if (i->status != CANCELADA && inscricao_existe(arquivo->inscricoes, i->idParticipante,
+                                                                      i->idEvento)) {
+                    // O índice guarda uma inscrição ativa por par; a segunda deixaria a contagem divergente
+                    carga_anotar_erro(&arquivo->relatorio, arquivo->nome, i->linha, 1, "inscrição repetida", false);
+                } else {
+                    Inscricao* nova = inscricao_criar(i->participante, i->evento, i->data, i->status);
+                    lista_inscricoes_adicionar(arquivo->inscricoes, arquivo->eventos, arquivo->participantes, nova);
+                }
+            }
+        }
+        liberar_memoria(bloco->registros);
+        liberar_memoria(bloco->relatorio.dados);
+    }
     
-    if (evento != NULL) {
-        *lista_eventos = eventos_remover(*lista_eventos, id);
-        printf("\nEvento removido com sucesso!\n");
-    } else {
-        printf("\nEvento não encontrado!\n");
+    if (arquivo->tipo == CARGA_EVENTOS) {
+        // Uma única ordenação deixa a visão por data pronta; depois ela é mantida incrementalmente
+        ordenar_eventos_por_data(arquivo->eventos, contar_eventos(arquivo->eventos));
     }
+    liberar_memoria(arquivo->blocos);
+    liberar_memoria(arquivo->conteudo);
 }
 
-// ====== FUNÇÕES PARA GERENCIAMENTO DE PARTICIPANTES ====== 
-
-// Função para adicionar um participante
-void adicionar_participante(ListaParticipantes* lista_participantes, int* proximoIdParticipante) {
-    char nome[100], email[100], telefone[20];
-    
-    printf("\n== Adicionar Novo Participante ==\n");
-    
-    printf("Nome: ");
-    scanf(" %[^\n]", nome);
+// Função para carregar eventos.csv, participantes.csv e inscricoes.csv em paralelo: cada arquivo
+// é dividido em blocos de linhas inteiras convertidos por um grupo de tarefas; eventos e
+// participantes são integrados ao mesmo tempo e as inscrições são resolvidas quando ambos estão
+// prontos. Os erros saem no formato e na ordem da leitura sequencial
+void carregar_arquivos_csv(TabelaEventos* eventos, TabelaParticipantes* participantes, ListaInscricoes* inscricoes,
+                           int* proximoIdEvento, int* proximoIdParticipante) {
+    static const char* const nomes[] = { "eventos.csv", "participantes.csv", "inscricoes.csv" };
+    int tarefas = tarefas_configuradas > 0 ? tarefas_configuradas : processadores_disponiveis();
+    ArquivoCarga arquivos[3];
+    void* trabalhos[3];
+    for (int a = 0; a < 3; a++) {
+        memset(&arquivos[a], 0, sizeof(ArquivoCarga));
+        arquivos[a].tipo = (TipoCarga)a;
+        arquivos[a].nome = nomes[a];
+        arquivos[a].eventos = eventos;
+        arquivos[a].participantes = participantes;
+        arquivos[a].inscricoes = inscricoes;
+        trabalhos[a] = &arquivos[a];
+    }
+    arquivos[CARGA_EVENTOS].proximoId = proximoIdEvento;
+    arquivos[CARGA_PARTICIPANTES].proximoId = proximoIdParticipante;
     
-    printf("Email: ");
-    scanf(" %[^\n]", email);
+    // Leitura dos arquivos inteiros e divisão em blocos (a contagem de aspas e quebras dos
+    // trechos brutos, que posiciona as fronteiras, também é paralela)
+    executar_em_paralelo(carga_ler_arquivo, trabalhos, 3, tarefas);
+    int total = 0;
+    for (int a = 0; a < 3; a++) {
+        carga_dividir(&arquivos[a], tarefas);
+        total += arquivos[a].quantidade_blocos;
+    }
+    void** blocos = (void**)alocar_memoria((size_t)(total > 0 ? total : 1) * sizeof(void*));
+    int n = 0;
+    for (int a = 0; a < 3; a++) {
+        for (int b = 0; b < arquivos[a].quantidade_blocos; b++) {
+            blocos[n++] = &arquivos[a].blocos[b];
+        }
+    }
+    executar_em_paralelo(carga_contar_trecho, blocos, total, tarefas);
+    for (int a = 0; a < 3; a++) {
+        carga_ajustar_fronteiras(&arquivos[a]);
+    }
     
-    printf("Telefone: ");
-    scanf(" %[^\n]", telefone);
+    // Conversão de todos os blocos dos três arquivos pelo mesmo grupo de tarefas
+    executar_em_paralelo(carga_converter_bloco, blocos, total, tarefas);
     
-    Participante* novo = participante_criar(*proximoIdParticipante, nome, email, telefone);
-    lista_participantes_adicionar(lista_participantes, novo);
+    // Integração de eventos e participantes, uma tarefa para cada
+    executar_em_paralelo(carga_integrar, trabalhos, 2, tarefas);
     
-    (*proximoIdParticipante)++;
+    // Resolução das inscrições por bloco e inserção na ordem do arquivo
+    int blocos_inscricoes = arquivos[CARGA_INSCRICOES].quantidade_blocos;
+    executar_em_paralelo(carga_resolver_bloco, blocos + (total - blocos_inscricoes), blocos_inscricoes, tarefas);
+    carga_integrar(&arquivos[CARGA_INSCRICOES]);
     
-    printf("\nParticipante adicionado com sucesso! ID: %d\n", novo->id);
+    for (int a = 0; a < 3; a++) {
+        if (arquivos[a].relatorio.usados > 0) {
+            fwrite(arquivos[a].relatorio.dados, 1, arquivos[a].relatorio.usados, stderr);
+        }
+        liberar_memoria(arquivos[a].relatorio.dados);
+    }
+    liberar_memoria(blocos);
 }
 
-// Função para buscar e exibir um participante por ID
-void buscar_participante(ListaParticipantes* lista_participantes) {
-    int id;
-    
-    printf("\n== Buscar Participante por ID ==\n");
-    printf("ID do participante: ");
-    scanf("%d", &id);
+// ====== RECUPERAÇÃO E CHECKPOINT ======
+
+// Função para gravar um log vazio (apenas o cabeçalho, com o LSN atual como base) de forma atômica
+// e reabri-lo para acréscimo
+static bool log_reiniciar(LogOperacoes* log) {
+    if (log->arquivo != NULL) {
+        fclose(log->arquivo);
+        log->arquivo = NULL;
+    }
     
-    Participante* participante = lista_participantes_buscar_por_id(lista_participantes, id);
+    CabecalhoLog cabecalho;
+    memset(&cabecalho, 0, sizeof(cabecalho));
+    memcpy(cabecalho.magica, "EVWAL", 5);
+    cabecalho.versao = LOG_VERSAO;
+    cabecalho.ordem_bytes = ORDEM_BYTES;
+    cabecalho.lsn_base = log->ultimo_lsn;
+    cabecalho.soma = soma_verificacao(&cabecalho, offsetof(CabecalhoLog, soma));
     
-    if (participante != NULL) {
-        printf("\n=== PARTICIPANTE ENCONTRADO ===\n");
-        printf("ID: %d\n", participante->id);
-        printf("Nome: %s\n", participante->nome);
-        printf("Email: %s\n", participante->email);
-        printf("Telefone: %s\n", participante->telefone);
-    } else {
-        printf("\nParticipante não encontrado!\n");
+    EscritorCSV escritor;
+    bool ok = csv_criar(&escritor, log->caminho);
+    if (ok) {
+        csv_escrever_bruto(&escritor, (const char*)&cabecalho, sizeof(cabecalho));
+        ok = csv_concluir(&escritor);
     }
+    if (ok) {
+        log->arquivo = fopen(log->caminho, "ab");
+        ok = log->arquivo != NULL;
+    }
+    log->falhou = !ok;
+    log->registros.usados = 0;
+    log->pendentes = 0;
+    liberar_memoria(log->conteudo);
+    log->conteudo = NULL;
+    log->tamanho_conteudo = 0;
+    return ok;
 }
 
-// Função para editar um participante
-void editar_participante(ListaParticipantes* lista_participantes) {
-    int id;
+// Função para guardar o arquivo de log atual com outro nome (para inspeção) antes de reiniciá-lo
+static void log_preservar(LogOperacoes* log, const char* sufixo) {
+    if (log->arquivo != NULL) {
+        fclose(log->arquivo);
+        log->arquivo = NULL;
+    }
+    size_t comprimento = strlen(log->caminho);
+    size_t extra = strlen(sufixo);
+    char* destino = (char*)alocar_memoria(comprimento + extra + 1);
+    memcpy(destino, log->caminho, comprimento);
+    memcpy(destino + comprimento, sufixo, extra + 1);
+    remove(destino);
+    if (rename(log->caminho, destino) == 0) {
+        fprintf(stderr, "O log anterior foi preservado em %s\n", destino);
+    }
+    liberar_memoria(destino);
+}
+
+// Função para abrir o log: valida o cabeçalho, descarta um final incompleto (gravação interrompida)
+// e guarda os registros válidos para a reaplicação
+void log_abrir(LogOperacoes* log, const char* caminho, PoliticaSincronizacao politica) {
+    memset(log, 0, sizeof(*log));
+    log->caminho = caminho;
+    log->politica = politica;
+    log->registros_por_grupo = LOG_GRUPO_REGISTROS;
     
-    printf("\n== Editar Participante ==\n");
-    printf("ID do participante a ser editado: ");
-    scanf("%d", &id);
+    size_t tamanho;
+    char* dados = snapshot_ler_arquivo(caminho, &tamanho);
+    if (dados == NULL) {
+        log_reiniciar(log);
+        return;
+    }
     
-    Participante* participante = lista_participantes_buscar_por_id(lista_participantes, id);
+    CabecalhoLog cabecalho;
+    if (tamanho < sizeof(cabecalho)) {
+        memset(&cabecalho, 0, sizeof(cabecalho));
+    } else {
+        memcpy(&cabecalho, dados, sizeof(cabecalho));
+    }
+    if (memcmp(cabecalho.magica, "EVWAL", 5) != 0 || cabecalho.versao != LOG_VERSAO ||
+        cabecalho.ordem_bytes != ORDEM_BYTES ||
+        cabecalho.soma != soma_verificacao(&cabecalho, offsetof(CabecalhoLog, soma))) {
+        fprintf(stderr, "Log %s inválido: iniciando um novo\n", caminho);
+        liberar_memoria(dados);
+        log_preservar(log, ".corrompido");
+        log_reiniciar(log);
+        return;
+    }
     
-    if (participante != NULL) {
-        printf("\n=== EDITANDO PARTICIPANTE ===\n");
-        printf("Nome atual: %s\n", participante->nome);
-        printf("Novo nome (ou pressione Enter para manter): ");
-        char nome[100];
-        getchar(); // Limpar o buffer
-        fgets(nome, sizeof(nome), stdin);
-   if (nome[0] != '\n') {
-            nome[strcspn(nome, "\n")] = 0; // Remover o \n do final
-            strncpy(participante->nome, nome, sizeof(participante->nome)-1);
+    // Os registros valem até o primeiro incompleto, com soma errada ou fora de sequência
+    log->ultimo_lsn = cabecalho.lsn_base;
+    size_t valido = sizeof(cabecalho);
+    CabecalhoRegistroLog registro;
+    while (tamanho - valido >= sizeof(registro)) {
+        memcpy(&registro, dados + valido, sizeof(registro));
+        if (registro.tamanho == 0 || registro.tamanho > tamanho - valido - sizeof(registro) ||
+            registro.lsn <= log->ultimo_lsn ||
+            registro.soma != (uint32_t)soma_verificacao(dados + valido + offsetof(CabecalhoRegistroLog, lsn),
+                                                        sizeof(registro.lsn) + registro.tamanho)) {
+            break;
         }
-        
-        printf("Email atual: %s\n", participante->email);
-        printf("Novo email (ou pressione Enter para manter): ");
-        char email[100];
-        fgets(email, sizeof(email), stdin);
-        if (email[0] != '\n') {
-            email[strcspn(email, "\n")] = 0;
-            strncpy(participante->email, email, sizeof(participante->email)-1);
+        log->ultimo_lsn = registro.lsn;
+        valido += sizeof(registro) + registro.tamanho;
+    }
+    
+    if (valido < tamanho) {
+        // Regrava só a parte válida, para que novos registros não fiquem depois de lixo
+        fprintf(stderr, "Log %s: descartados %lu bytes de um registro incompleto\n",
+                caminho, (unsigned long)(tamanho - valido));
+        EscritorCSV escritor;
+        bool ok = csv_criar(&escritor, caminho);
+        if (ok) {
+            csv_escrever_bruto(&escritor, dados, valido);
+            ok = csv_concluir(&escritor);
         }
-        
-        printf("Telefone atual: %s\n", participante->telefone);
-        printf("Novo telefone (ou pressione Enter para manter): ");
-        char telefone[20];
-        fgets(telefone, sizeof(telefone), stdin);
-        if (telefone[0] != '\n') {
-            telefone[strcspn(telefone, "\n")] = 0;
-            strncpy(participante->telefone, telefone, sizeof(participante->telefone)-1);
+        if (!ok) {
+            log->falhou = true;
         }
-        
-        printf("\nParticipante atualizado com sucesso!\n");
-    } else {
-        printf("\nParticipante não encontrado!\n");
+    }
+    
+    log->conteudo = dados;
+    log->tamanho_conteudo = valido;
+    if (!log->falhou) {
+        log->arquivo = fopen(caminho, "ab");
+        log->falhou = log->arquivo == NULL;
+    }
+    if (log->falhou) {
+        fprintf(stderr, "Erro ao abrir %s: as alterações só serão salvas ao sair\n", caminho);
     }
 }
 
-// Função para remover um participante
-void remover_participante(ListaParticipantes* lista_participantes) {
-    int id;
-    
-    printf("\n== Remover Participante ==\n");
-    printf("ID do participante a ser removido: ");
-    scanf("%d", &id);
+// Função para verificar se o log tem operações registradas desde o último checkpoint
+bool log_pendente(const LogOperacoes* log) {
+    return log->tamanho_conteudo > sizeof(CabecalhoLog);
+}
+
+// Função para reaplicar uma operação do log (false se ela não se aplica ao estado atual)
+static bool log_aplicar(LeitorBytes* leitor, TabelaEventos* eventos, TabelaParticipantes* participantes,
+                        ListaInscricoes* inscricoes, int* proximoIdEvento, int* proximoIdParticipante) {
+    TipoOperacao tipo = (TipoOperacao)(uint8_t)*leitor->atual++;
+    int id = leitor_inteiro(leitor);
     
-    Participante* participante = lista_participantes_buscar_por_id(lista_participantes, id);
+    switch (tipo) {
+        case OP_EVENTO_CRIAR:
+        case OP_EVENTO_ALTERAR: {
+            const char* nome = leitor_texto(leitor);
+            const char* descricao = leitor_texto(leitor);
+            const char* categoria = leitor_texto(leitor);
+            uint32_t data = (uint32_t)leitor_inteiro(leitor);
+            int capacidade = leitor_inteiro(leitor);
+            int pos = eventos_buscar_por_id(eventos, id);
+            if (leitor->erro || data == 0 || (pos == -1) != (tipo == OP_EVENTO_CRIAR)) {
+                return false;
+            }
+            if (tipo == OP_EVENTO_CRIAR) {
+                eventos_adicionar(eventos, id, nome, descricao, categoria, data, capacidade);
+                if (id >= *proximoIdEvento) *proximoIdEvento = id + 1;
+                return true;
+            }
+            if (strcmp(nome, eventos_nome(eventos, pos)) != 0) {
+                eventos_definir_nome(eventos, pos, nome);
+            }
+            if (strcmp(descricao, eventos_descricao(eventos, pos)) != 0) {
+                eventos_definir_descricao(eventos, pos, descricao);
+            }
+            if (strcmp(categoria, eventos_categoria(eventos, pos)) != 0) {
+                eventos_definir_categoria(eventos, pos, categoria);
+            }
+            if (data != eventos->data[pos]) {
+                eventos_alterar_data(eventos, pos, data);
+            }
+            eventos_definir_capacidade(eventos, pos, capacidade);
+            lista_espera_promover(inscricoes, eventos, participantes, pos);
+            return true;
+        }
+        case OP_EVENTO_REMOVER:
+            if (leitor->erro || eventos_buscar_por_id(eventos, id) == -1) {
+                return false;
+            }
+            lista_inscricoes_remover_evento(inscricoes, eventos, participantes, id);
+            return true;
+        case OP_PARTICIPANTE_CRIAR:
+        case OP_PARTICIPANTE_ALTERAR: {
+            const char* nome = leitor_texto(leitor);
+            const char* email = leitor_texto(leitor);
+            const char* telefone = leitor_texto(leitor);
+            int participante = participantes_buscar_por_id(participantes, id);
+            if (leitor->erro || (participante == -1) != (tipo == OP_PARTICIPANTE_CRIAR)) {
+                return false;
+            }
+            if (tipo == OP_PARTICIPANTE_CRIAR) {
+                participantes_adicionar(participantes, id, nome, email, telefone);
+                if (id >= *proximoIdParticipante) *proximoIdParticipante = id + 1;
+            } else {
+                participantes_atualizar(participantes, participante, nome, email, telefone);
+            }
+            return true;
+        }
+        case OP_PARTICIPANTE_REMOVER:
+            if (leitor->erro || participantes_buscar_por_id(participantes, id) == -1) {
+                return false;
+            }
+            lista_inscricoes_remover_participante(inscricoes, eventos, participantes, id, true);
+            return true;
+        case OP_INSCRICAO_CRIAR: {
+            int idEvento = leitor_inteiro(leitor);
+            uint32_t data = (uint32_t)leitor_inteiro(leitor);
+            int participante = participantes_buscar_por_id(participantes, id);
+            int evento = eventos_buscar_por_id(eventos, idEvento);
+            if (leitor->erro || data == 0 || participante == -1 || evento == -1 ||
+                inscricao_existe(inscricoes, id, idEvento)) {
+                return false;
+            }
+            char texto_data[11];
+            data_formatar(data, texto_data);
+            lista_inscricoes_inscrever(inscricoes, eventos, participantes, participante, evento, texto_data);
+            return true;
+        }
+        case OP_INSCRICAO_CANCELAR: {
+            int idEvento = leitor_inteiro(leitor);
+            return !leitor->erro && lista_inscricoes_cancelar(inscricoes, eventos, participantes, id, idEvento);
+        }
+    }
+    return false;
+}
+
+// Função para reaplicar sobre o snapshot carregado as operações do log posteriores a ele
+// (devolve quantas foram aplicadas; o conteúdo lido na abertura é liberado)
+int log_reaplicar(LogOperacoes* log, uint64_t lsn_base, TabelaEventos* eventos, TabelaParticipantes* participantes,
+                  ListaInscricoes* inscricoes, int* proximoIdEvento, int* proximoIdParticipante) {
+    int aplicadas = 0;
+    int ignoradas = 0;
+    size_t deslocamento = sizeof(CabecalhoLog);
+    while (deslocamento < log->tamanho_conteudo) {
+        CabecalhoRegistroLog registro;
+        memcpy(&registro, log->conteudo + deslocamento, sizeof(registro));
+        char* inicio = log->conteudo + deslocamento + sizeof(registro);
+        deslocamento += sizeof(registro) + registro.tamanho;
+        
+        // Registros já incluídos no snapshot (checkpoint interrompido antes de reiniciar o log)
+        if (registro.lsn <= lsn_base) {
+            continue;
+        }
+        LeitorBytes leitor = { inicio, inicio + registro.tamanho, false };
+        if (log_aplicar(&leitor, eventos, participantes, inscricoes, proximoIdEvento, proximoIdParticipante)) {
+            aplicadas++;
+        } else {
+            ignoradas++;
+        }
+    }
+    if (ignoradas > 0) {
+        fprintf(stderr, "Log %s: %d operações não se aplicavam ao estado carregado e foram ignoradas\n",
+                log->caminho, ignoradas);
+    }
+    if (lsn_base > log->ultimo_lsn) {
+        log->ultimo_lsn = lsn_base;
+    }
     
-    if (participante != NULL) {
-        lista_participantes_remover(lista_participantes, id);
-        printf("\nParticipante removido com sucesso!\n");
-    } else {
-        printf("\nParticipante não encontrado!\n");
+    liberar_memoria(log->conteudo);
+    log->conteudo = NULL;
+    return aplicadas;
+}
+
+// Função para fechar o log, confirmando os registros pendentes
+void log_fechar(LogOperacoes* log) {
+    log_confirmar(log);
+    if (log->arquivo != NULL) {
+        fclose(log->arquivo);
+    }
+    liberar_memoria(log->registros.dados);
+    liberar_memoria(log->conteudo);
+    memset(log, 0, sizeof(*log));
+}
+
+// ====== SEGMENTOS INCREMENTAIS ======
+
+#define SEGMENTO_VERSAO 2
+#define SEGMENTOS_PROPORCAO 4     // Compacta quando os segmentos passam de 1/4 do snapshot
+#define SEGMENTOS_MAXIMO 64       // ... ou quando há segmentos demais para ler na inicialização
+#define ARQUIVO_CANCELADAS "inscricoes_canceladas.csv"
+
+// Porcentagem de inscrições canceladas (lápides) que faz o checkpoint compactar e arquivá-las
+// (--limite-canceladas; 100 desativa a compactação automática por esse motivo)
+static int limite_canceladas = 25;
+
+// Cabeçalho de um segmento (dados.bin.N): alterações gravadas por um checkpoint, seguidas do conteúdo
+typedef struct cabecalho_segmento {
+    char magica[8];              // "EVSEG"
+    uint32_t versao;
+    uint32_t ordem_bytes;        // ORDEM_BYTES
+    uint64_t lsn;                // Última operação do log incluída no segmento
+    uint32_t eventos;            // Eventos criados ou alterados (estado completo)
+    uint32_t eventos_removidos;
+    uint32_t participantes;      // Participantes criados ou alterados (estado completo)
+    uint32_t participantes_removidos;
+    uint32_t inscricoes;         // Inscrições novas
+    uint32_t alteracoes;         // Mudanças de status de inscrições já gravadas
+    uint64_t bytes;              // Tamanho do conteúdo
+    uint64_t soma;               // Soma do conteúdo
+    uint64_t soma_cabecalho;     // Soma de todos os campos anteriores
+} CabecalhoSegmento;
+
+// Segmentos gravados desde a última compactação
+typedef struct segmentos {
+    int quantidade;              // Arquivos dados.bin.1 .. dados.bin.N
+    uint64_t bytes;
+    uint64_t bytes_snapshot;     // Tamanho do snapshot completo que os segmentos complementam
+} Segmentos;
+
+// Função para montar o nome do arquivo do segmento de número indicado
+static void segmento_caminho(char* destino, size_t tamanho, int numero) {
+    snprintf(destino, tamanho, "%s.%d", ARQUIVO_SNAPSHOT, numero);
+}
+
+// Função para localizar os segmentos existentes (numerados a partir de 1, sem lacunas)
+void segmentos_contar(Segmentos* segmentos) {
+    struct stat info;
+    char caminho[64];
+    segmentos->quantidade = 0;
+    segmentos->bytes = 0;
+    segmentos->bytes_snapshot = stat(ARQUIVO_SNAPSHOT, &info) == 0 ? (uint64_t)info.st_size : 0;
+    for (;;) {
+        segmento_caminho(caminho, sizeof(caminho), segmentos->quantidade + 1);
+        if (stat(caminho, &info) != 0) {
+            break;
+        }
+        segmentos->quantidade++;
+        segmentos->bytes += (uint64_t)info.st_size;
+    }
+}
+
+// Função para apagar os segmentos (do último para o primeiro, para que uma interrupção
+// deixe uma sequência sem lacunas; os que sobrarem têm LSN antigo e são ignorados)
+void segmentos_remover(Segmentos* segmentos) {
+    char caminho[64];
+    for (int numero = segmentos->quantidade; numero >= 1; numero--) {
+        segmento_caminho(caminho, sizeof(caminho), numero);
+        remove(caminho);
     }
+    segmentos->quantidade = 0;
+    segmentos->bytes = 0;
 }
 
-// ====== FUNÇÕES PARA GERENCIAMENTO DE INSCRIÇÕES ======
+// Função para verificar se há alterações ainda não gravadas em segmento ou snapshot
+bool alteracoes_pendentes(const TabelaEventos* eventos, const TabelaParticipantes* participantes,
+                          const ListaInscricoes* inscricoes) {
+    return eventos->alterados.quantidade > 0 || participantes->alterados.quantidade > 0 ||
+           inscricoes->quantidade_alteracoes > 0 || inscricoes->persistidas_ate != inscricoes->fim;
+}
 
-// Função para processar uma nova inscrição
-void nova_inscricao(Evento* lista_eventos, ListaParticipantes* lista_participantes, 
-                    ListaInscricoes* lista_inscricoes) {
-    int idEvento, idParticipante;
+// Função para dar as alterações por gravadas
+void alteracoes_limpar(TabelaEventos* eventos, TabelaParticipantes* participantes, ListaInscricoes* inscricoes) {
+    conjunto_ids_limpar(&eventos->alterados);
+    conjunto_ids_limpar(&participantes->alterados);
+    inscricoes->quantidade_alteracoes = 0;
+    inscricoes->persistidas_ate = inscricoes->fim;
+}
+
+// Função para gravar um novo segmento apenas com os registros alterados desde o último checkpoint
+// (o custo depende da quantidade de alterações, não do tamanho da base)
+bool segmento_gravar(Segmentos* segmentos, uint64_t lsn, TabelaEventos* eventos,
+                     TabelaParticipantes* participantes, ListaInscricoes* inscricoes) {
+    CabecalhoSegmento cabecalho;
+    memset(&cabecalho, 0, sizeof(cabecalho));
+    BufferBytes conteudo = { NULL, 0, 0 };
     
-    printf("\n== Nova Inscrição ==\n");
-    printf("ID do evento: ");
-    scanf("%d", &idEvento);
+    // Eventos vivos com o estado completo; depois, os IDs dos removidos
+    for (int k = 0; k < eventos->alterados.quantidade; k++) {
+        int pos = eventos_buscar_por_id(eventos, eventos->alterados.ids[k]);
+        if (pos == -1) {
+            continue;
+        }
+        buffer_inteiro(&conteudo, eventos->id[pos]);
+        buffer_inteiro(&conteudo, eventos->capacidade[pos]);
+        buffer_inteiro(&conteudo, eventos->vagasDisponiveis[pos]);
+        buffer_inteiro(&conteudo, (int32_t)eventos->data[pos]);
+        buffer_texto(&conteudo, eventos_nome(eventos, pos));
+        buffer_texto(&conteudo, eventos_descricao(eventos, pos));
+        buffer_texto(&conteudo, eventos_categoria(eventos, pos));
+        cabecalho.eventos++;
+    }
+    for (int k = 0; k < eventos->alterados.quantidade; k++) {
+        if (eventos_buscar_por_id(eventos, eventos->alterados.ids[k]) == -1) {
+            buffer_inteiro(&conteudo, eventos->alterados.ids[k]);
+            cabecalho.eventos_removidos++;
+        }
+    }
     
-    Evento* evento = eventos_buscar_por_id(lista_eventos, idEvento);
-    if (evento == NULL) {
-        printf("\nEvento não encontrado!\n");
-        return;
+    for (int k = 0; k < participantes->alterados.quantidade; k++) {
+        int pos = participantes_buscar_por_id(participantes, participantes->alterados.ids[k]);
+        if (pos == -1) {
+            continue;
+        }
+        buffer_inteiro(&conteudo, participantes->registros[pos].id);
+        buffer_texto(&conteudo, participantes_nome(participantes, pos));
+        buffer_texto(&conteudo, participantes_email(participantes, pos));
+        buffer_texto(&conteudo, participantes_telefone(participantes, pos));
+        cabecalho.participantes++;
+    }
+    for (int k = 0; k < participantes->alterados.quantidade; k++) {
+        if (participantes_buscar_por_id(participantes, participantes->alterados.ids[k]) == -1) {
+            buffer_inteiro(&conteudo, participantes->alterados.ids[k]);
+            cabecalho.participantes_removidos++;
+        }
     }
     
-    if (evento->vagasDisponiveis <= 0) {
-        printf("\nNão há vagas disponíveis para este evento!\n");
-        return;
+    // Mudanças de status primeiro: na carga elas valem para as inscrições já gravadas, antes das novas
+    for (int k = 0; k < inscricoes->quantidade_alteracoes; k++) {
+        buffer_inteiro(&conteudo, (int32_t)(inscricoes->alteracoes[k].chave >> 32));
+        buffer_inteiro(&conteudo, (int32_t)(uint32_t)inscricoes->alteracoes[k].chave);
+        buffer_inteiro(&conteudo, (int32_t)inscricoes->alteracoes[k].status);
+        cabecalho.alteracoes++;
+    }
+    Inscricao* nova = inscricoes->persistidas_ate != NULL ? inscricoes->persistidas_ate->proxima : inscricoes->inicio;
+    for (; nova != NULL; nova = nova->proxima) {
+        buffer_inteiro(&conteudo, participantes->registros[nova->participante].id);
+        buffer_inteiro(&conteudo, eventos->id[nova->evento]);
+        buffer_inteiro(&conteudo, (int32_t)data_compactar_estrita(nova->dataInscricao, strlen(nova->dataInscricao)));
+        buffer_inteiro(&conteudo, (int32_t)nova->status);
+        cabecalho.inscricoes++;
     }
     
-    printf("ID do participante: ");
-    scanf("%d", &idParticipante);
+    memcpy(cabecalho.magica, "EVSEG", 5);
+    cabecalho.versao = SEGMENTO_VERSAO;
+    cabecalho.ordem_bytes = ORDEM_BYTES;
+    cabecalho.lsn = lsn;
+    cabecalho.bytes = conteudo.usados;
+    cabecalho.soma = soma_verificacao(conteudo.dados, conteudo.usados);
+    cabecalho.soma_cabecalho = soma_verificacao(&cabecalho, offsetof(CabecalhoSegmento, soma_cabecalho));
     
-    Participante* participante = lista_participantes_buscar_por_id(lista_participantes, idParticipante);
-    if (participante == NULL) {
-        printf("\nParticipante não encontrado!\n");
-        return;
+    char caminho[64];
+    segmento_caminho(caminho, sizeof(caminho), segmentos->quantidade + 1);
+    EscritorCSV escritor;
+    bool ok = csv_criar(&escritor, caminho);
+    if (ok) {
+        csv_escrever_bruto(&escritor, (const char*)&cabecalho, sizeof(cabecalho));
+        csv_escrever_bruto(&escritor, conteudo.dados, conteudo.usados);
+        ok = csv_concluir(&escritor);
+    }
+    if (ok) {
+        segmentos->quantidade++;
+        segmentos->bytes += sizeof(cabecalho) + conteudo.usados;
+    }
+    liberar_memoria(conteudo.dados);
+    return ok;
+}
+
+// Função para aplicar um segmento sobre o estado carregado; segmentos com LSN já incluído são
+// ignorados (false se o arquivo estiver corrompido)
+static bool segmento_aplicar(const char* caminho, uint64_t* lsn, TabelaEventos* eventos,
+                             TabelaParticipantes* participantes, ListaInscricoes* inscricoes,
+                             int* proximoIdEvento, int* proximoIdParticipante) {
+    size_t tamanho;
+    char* dados = snapshot_ler_arquivo(caminho, &tamanho);
+    if (dados == NULL) {
+        return false;
+    }
+    CabecalhoSegmento cabecalho;
+    if (tamanho < sizeof(cabecalho)) {
+        liberar_memoria(dados);
+        return false;
+    }
+    memcpy(&cabecalho, dados, sizeof(cabecalho));
+    if (memcmp(cabecalho.magica, "EVSEG", 5) != 0 || cabecalho.versao != SEGMENTO_VERSAO ||
+        cabecalho.ordem_bytes != ORDEM_BYTES ||
+        cabecalho.soma_cabecalho != soma_verificacao(&cabecalho, offsetof(CabecalhoSegmento, soma_cabecalho)) ||
+        cabecalho.bytes != tamanho - sizeof(cabecalho) ||
+        cabecalho.soma != soma_verificacao(dados + sizeof(cabecalho), (size_t)cabecalho.bytes)) {
+        liberar_memoria(dados);
+        return false;
+    }
+    if (cabecalho.lsn <= *lsn) {
+        liberar_memoria(dados);
+        return true;
     }
     
-    // Verificar se o participante já está inscrito
-    if (inscricao_existe(lista_inscricoes, idParticipante, idEvento)) {
-        printf("\nEste participante já está inscrito neste evento!\n");
-        return;
+    LeitorBytes leitor = { dados + sizeof(cabecalho), dados + tamanho, false };
+    
+    // Eventos: estado completo (as vagas são acertadas no fim, depois das inscrições)
+    int* vagas = (int*)alocar_memoria(((size_t)cabecalho.eventos + 1) * 2 * sizeof(int));
+    uint32_t quantidade_vagas = 0;
+    for (uint32_t k = 0; k < cabecalho.eventos && !leitor.erro; k++) {
+        int id = leitor_inteiro(&leitor);
+        int capacidade = leitor_inteiro(&leitor);
+        int disponiveis = leitor_inteiro(&leitor);
+        uint32_t data = (uint32_t)leitor_inteiro(&leitor);
+        const char* nome = leitor_texto(&leitor);
+        const char* descricao = leitor_texto(&leitor);
+        const char* categoria = leitor_texto(&leitor);
+        if (leitor.erro || data == 0) {
+            leitor.erro = true;
+            break;
+        }
+        vagas[2 * quantidade_vagas] = id;
+        vagas[2 * quantidade_vagas + 1] = disponiveis;
+        quantidade_vagas++;
+        int pos = eventos_buscar_por_id(eventos, id);
+        if (pos == -1) {
+            eventos_adicionar(eventos, id, nome, descricao, categoria, data, capacidade);
+            if (id >= *proximoIdEvento) *proximoIdEvento = id + 1;
+            continue;
+        }
+        if (strcmp(nome, eventos_nome(eventos, pos)) != 0) eventos_definir_nome(eventos, pos, nome);
+        if (strcmp(descricao, eventos_descricao(eventos, pos)) != 0) eventos_definir_descricao(eventos, pos, descricao);
+        eventos_definir_categoria(eventos, pos, categoria);
+        if (data != eventos->data[pos]) eventos_alterar_data(eventos, pos, data);
+        eventos_definir_capacidade(eventos, pos, capacidade);
+    }
+    for (uint32_t k = 0; k < cabecalho.eventos_removidos && !leitor.erro; k++) {
+        lista_inscricoes_remover_evento(inscricoes, eventos, participantes, leitor_inteiro(&leitor));
     }
     
-    // Obter data atual
-    char dataAtual[11];
-    obter_data_atual(dataAtual);
+    for (uint32_t k = 0; k < cabecalho.participantes && !leitor.erro; k++) {
+        int id = leitor_inteiro(&leitor);
+        const char* nome = leitor_texto(&leitor);
+        const char* email = leitor_texto(&leitor);
+        const char* telefone = leitor_texto(&leitor);
+        if (leitor.erro) {
+            break;
+        }
+        int participante = participantes_buscar_por_id(participantes, id);
+        if (participante == -1) {
+            participantes_adicionar(participantes, id, nome, email, telefone);
+            if (id >= *proximoIdParticipante) *proximoIdParticipante = id + 1;
+        } else {
+            participantes_atualizar(participantes, participante, nome, email, telefone);
+        }
+    }
+    // As promoções causadas pelas vagas devolvidas já vêm registradas como mudanças de status
+    for (uint32_t k = 0; k < cabecalho.participantes_removidos && !leitor.erro; k++) {
+        lista_inscricoes_remover_participante(inscricoes, eventos, participantes, leitor_inteiro(&leitor), false);
+    }
     
-    // Criar e adicionar a inscrição
-    Inscricao* nova = inscricao_criar(participante, evento, dataAtual, CONFIRMADA);
-    lista_inscricoes_adicionar(lista_inscricoes, nova);
+    // Promoções já vêm registradas como mudanças: o status é aplicado como gravado, sem promover
+    // de novo (as vagas são acertadas no fim)
+    for (uint32_t k = 0; k < cabecalho.alteracoes && !leitor.erro; k++) {
+        int idParticipante = leitor_inteiro(&leitor);
+        int idEvento = leitor_inteiro(&leitor);
+        int status = leitor_inteiro(&leitor);
+        Inscricao* inscricao = (Inscricao*)indice_buscar(&inscricoes->indice,
+                                                         indice_chave_inscricao(idParticipante, idEvento));
+        if (!leitor.erro && inscricao != NULL && (status == CONFIRMADA || status == CANCELADA) &&
+            (StatusInscricao)status != inscricao->status) {
+            inscricao_mudar_status(inscricoes, eventos, participantes, inscricao, (StatusInscricao)status);
+        }
+    }
+    char texto_data[11];
+    for (uint32_t k = 0; k < cabecalho.inscricoes && !leitor.erro; k++) {
+        int idParticipante = leitor_inteiro(&leitor);
+        int idEvento = leitor_inteiro(&leitor);
+        uint32_t data = (uint32_t)leitor_inteiro(&leitor);
+        int status = leitor_inteiro(&leitor);
+        int participante = participantes_buscar_por_id(participantes, idParticipante);
+        int evento = eventos_buscar_por_id(eventos, idEvento);
+        if (leitor.erro || participante == -1 || evento == -1 || data == 0 ||
+            status < CONFIRMADA || status > CANCELADA) {
+            continue;
+        }
+        data_formatar(data, texto_data);
+        lista_inscricoes_adicionar(inscricoes, eventos, participantes,
+                                   inscricao_criar(participante, evento, texto_data, (StatusInscricao)status));
+    }
     
-    // Atualizar vagas disponíveis
-    evento->vagasDisponiveis--;
+    // As vagas gravadas já refletem as inscrições e as mudanças de status do segmento
+    for (uint32_t k = 0; k < quantidade_vagas; k++) {
+        int pos = eventos_buscar_por_id(eventos, vagas[2 * k]);
+        if (pos != -1) {
+            eventos_ajustar_vagas(eventos, pos, vagas[2 * k + 1] - eventos->vagasDisponiveis[pos]);
+        }
+    }
+    liberar_memoria(vagas);
     
-    printf("\nInscrição realizada com sucesso!\n");
+    bool ok = !leitor.erro;
+    if (ok) {
+        *lsn = cabecalho.lsn;
+    }
+    liberar_memoria(dados);
+    return ok;
 }
 
-// Função para cancelar uma inscrição
-void cancelar_inscricao(ListaInscricoes* lista_inscricoes) {
-    int idEvento, idParticipante;
-    
-    printf("\n== Cancelar Inscrição ==\n");
-    printf("ID do evento: ");
-    scanf("%d", &idEvento);
-    
-    printf("ID do participante: ");
-    scanf("%d", &idParticipante);
-    
-    if (lista_inscricoes_cancelar(lista_inscricoes, idParticipante, idEvento)) {
-        printf("\nInscrição cancelada com sucesso!\n");
-    } else {
-        printf("\nInscrição não encontrada ou já cancelada!\n");
+// Função para aplicar os segmentos em ordem sobre o snapshot carregado, devolvendo o LSN
+// da última operação incluída (um segmento corrompido interrompe a sequência)
+uint64_t segmentos_aplicar(const Segmentos* segmentos, uint64_t lsn, TabelaEventos* eventos,
+                           TabelaParticipantes* participantes, ListaInscricoes* inscricoes,
+                           int* proximoIdEvento, int* proximoIdParticipante) {
+    char caminho[64];
+    for (int numero = 1; numero <= segmentos->quantidade; numero++) {
+        segmento_caminho(caminho, sizeof(caminho), numero);
+        if (!segmento_aplicar(caminho, &lsn, eventos, participantes, inscricoes,
+                              proximoIdEvento, proximoIdParticipante)) {
+            fprintf(stderr, "Segmento %s inválido ou corrompido: ele e os seguintes foram ignorados\n", caminho);
+            break;
+        }
     }
+    return lsn;
 }
 
-// ====== FUNÇÕES PARA RELATÓRIOS ======
+// Função para verificar se as inscrições canceladas passaram do limite configurado
+bool canceladas_demais(const ListaInscricoes* inscricoes) {
+    int canceladas = lista_inscricoes_canceladas(inscricoes);
+    return canceladas > 0 && (int64_t)canceladas * 100 > (int64_t)limite_canceladas * inscricoes->tamanho;
+}
 
-// Função para gerar relatório de eventos por categoria
-void relatorio_eventos_por_categoria(Evento* lista_eventos) {
-    char categoria[50];
-    bool encontrado = false;
+// Função para compactar: reescreve o estado completo (os CSVs, se pedido, e por último o snapshot
+// com o LSN da última operação), apaga os segmentos e só então reinicia o log. Com os CSVs, as
+// inscrições canceladas antes vão para o arquivo morto (sem eles, os CSVs continuariam a contê-las)
+bool compactar(LogOperacoes* log, Segmentos* segmentos, TabelaEventos* eventos, TabelaParticipantes* participantes,
+               ListaInscricoes* inscricoes, bool salvar_csv) {
+    log_confirmar(log);
+    if (salvar_csv) {
+        // Arquivadas antes dos arquivos que deixam de contê-las: se o sistema cair no meio, elas
+        // voltam com o snapshot anterior e são arquivadas de novo (linhas repetidas, nada perdido)
+        arquivar_inscricoes_canceladas(inscricoes, eventos, participantes, ARQUIVO_CANCELADAS);
+        salvar_eventos_csv(eventos, "eventos.csv");
+        salvar_participantes_csv(participantes, "participantes.csv");
+        salvar_inscricoes_csv(inscricoes, eventos, participantes, "inscricoes.csv");
+    }
+    if (!salvar_snapshot(eventos, participantes, inscricoes, ARQUIVO_SNAPSHOT, log->ultimo_lsn)) {
+        return false;
+    }
+    segmentos_remover(segmentos);
+    segmentos_contar(segmentos);
+    alteracoes_limpar(eventos, participantes, inscricoes);
+    return log_reiniciar(log);
+}
+
+// Função para fazer um checkpoint incremental: grava em um novo segmento apenas o que mudou,
+// reinicia o log e compacta quando os segmentos ficam grandes demais ou há canceladas demais
+bool checkpoint(LogOperacoes* log, Segmentos* segmentos, TabelaEventos* eventos, TabelaParticipantes* participantes,
+                ListaInscricoes* inscricoes) {
+    log_confirmar(log);
+    if (alteracoes_pendentes(eventos, participantes, inscricoes)) {
+        // O segmento recebe um LSN próprio: alterações que não passaram pelo log (importação em
+        // massa) também precisam ficar mais recentes que o snapshot
+        if (!segmento_gravar(segmentos, ++log->ultimo_lsn, eventos, participantes, inscricoes)) {
+            return false;
+        }
+        alteracoes_limpar(eventos, participantes, inscricoes);
+    }
+    if (segmentos->quantidade >= SEGMENTOS_MAXIMO ||
+        segmentos->bytes * SEGMENTOS_PROPORCAO > segmentos->bytes_snapshot || canceladas_demais(inscricoes)) {
+        return compactar(log, segmentos, eventos, participantes, inscricoes, true);
+    }
+    return log_reiniciar(log);
+}
+
+// Função para interpretar a política de sincronização do log informada na linha de comando
+bool politica_de_texto(const char* texto, PoliticaSincronizacao* politica) {
+    if (strcmp(texto, "sempre") == 0) {
+        *politica = LOG_SINCRONIZAR_SEMPRE;
+    } else if (strcmp(texto, "grupo") == 0) {
+        *politica = LOG_SINCRONIZAR_EM_GRUPO;
+    } else if (strcmp(texto, "nunca") == 0) {
+        *politica = LOG_SINCRONIZAR_NUNCA;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Função para converter entre os arquivos CSV e o snapshot binário (modo de linha de comando)
+int converter_arquivos(const char* opcao) {
+    bool para_binario = strcmp(opcao, "--csv-para-binario") == 0;
+    bool para_csv = strcmp(opcao, "--binario-para-csv") == 0;
+    if (!para_binario && !para_csv) {
+        fprintf(stderr, "Opção desconhecida: %s\n", opcao);
+        fprintf(stderr, "Uso: sistema_eventos [--sincronizar=sempre|grupo|nunca] [--tarefas=N] [--limite-canceladas=P] "
+                        "[--estresse-inscricoes[=N]] "
+                        "[--lote=<arquivo> | --importar-inscricoes=<arquivo> | "
+                        "--csv-para-binario | --binario-para-csv]\n");
+        return EXIT_FAILURE;
+    }
     
-    printf("\n== Relatório: Eventos por Categoria ==\n");
-    printf("Informe a categoria: ");
-    scanf(" %[^\n]", categoria);
+    // A conversão parte de um checkpoint: operações ainda no log ficariam de fora
+    LogOperacoes log;
+    log_abrir(&log, ARQUIVO_LOG, LOG_SINCRONIZAR_SEMPRE);
+    if (log_pendente(&log)) {
+        fprintf(stderr, "Há operações pendentes em %s: abra o sistema uma vez para aplicá-las antes de converter\n",
+                ARQUIVO_LOG);
+        log_fechar(&log);
+        return EXIT_FAILURE;
+    }
     
-    printf("\n=== EVENTOS DA CATEGORIA: %s ===\n", categoria);
+    TabelaEventos* eventos = tabela_eventos_criar();
+    TabelaParticipantes* participantes = tabela_participantes_criar();
+    ListaInscricoes* inscricoes = lista_inscricoes_criar();
+    int proximoIdEvento = 1;
+    int proximoIdParticipante = 1;
+    uint64_t lsn;
+    bool ok;
+    Segmentos segmentos;
+    segmentos_contar(&segmentos);
     
-    Evento* atual = lista_eventos;
-    while (atual != NULL) {
-        if (strcmp(atual->categoria, categoria) == 0) {
-            printf("ID: %d\n", atual->id);
-            printf("Nome: %s\n", atual->nome);
-            printf("Data: %s\n", atual->data);
-            printf("Vagas: %d/%d\n", atual->vagasDisponiveis, atual->capacidade);
-            printf("--------------------\n");
-            encontrado = true;
+    if (para_binario) {
+        // Os CSVs passam a ser a nova base: os segmentos, relativos à base anterior, são apagados
+        if (segmentos.quantidade > 0) {
+            fprintf(stderr, "Descartando %d segmentos de alterações da base anterior\n", segmentos.quantidade);
+        }
+        carregar_arquivos_csv(eventos, participantes, inscricoes, &proximoIdEvento, &proximoIdParticipante);
+        ok = compactar(&log, &segmentos, eventos, participantes, inscricoes, false);
+    } else {
+        ok = carregar_snapshot(eventos, participantes, inscricoes, ARQUIVO_SNAPSHOT,
+                               &proximoIdEvento, &proximoIdParticipante, &lsn);
+        if (ok) {
+            // Com segmentos, a exportação já compacta: os CSVs e o novo snapshot incluem as alterações
+            segmentos_aplicar(&segmentos, lsn, eventos, participantes, inscricoes,
+                              &proximoIdEvento, &proximoIdParticipante);
+            if (segmentos.quantidade > 0) {
+                ok = compactar(&log, &segmentos, eventos, participantes, inscricoes, true);
+            } else {
+                salvar_eventos_csv(eventos, "eventos.csv");
+                salvar_participantes_csv(participantes, "participantes.csv");
+                salvar_inscricoes_csv(inscricoes, eventos, participantes, "inscricoes.csv");
+            }
+        } else {
+            fprintf(stderr, "Não foi possível ler %s\n", ARQUIVO_SNAPSHOT);
         }
-        atual = atual->proximo;
     }
     
-    if (!encontrado) {
-        printf("Nenhum evento encontrado nesta categoria.\n");
+    if (ok) {
+        printf("Convertidos %d eventos, %d participantes e %d inscrições.\n",
+               eventos->tamanho, participantes->tamanho, inscricoes->tamanho);
     }
+    log_fechar(&log);
+    lista_inscricoes_destruir(inscricoes);
+    tabela_participantes_destruir(participantes);
+    tabela_eventos_destruir(eventos);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
-// Função para gerar relatório de eventos com vagas disponíveis
-void relatorio_eventos_com_vagas(Evento* lista_eventos) {
-    bool encontrado = false;
-    
-    printf("\n== Relatório: Eventos com Vagas Disponíveis ==\n");
+// ====== MODO EM LOTE ======
+
+// Função para executar um comando do lote já lido pelo leitor CSV; devolve NULL se foi aplicado
+// (com o ID criado ou o do evento afetado em *id, e a posição na lista de espera em *espera quando a
+// inscrição não conseguiu vaga) ou o motivo da rejeição
+static const char* lote_executar(LeitorCSV* leitor, TabelaEventos* eventos, TabelaParticipantes* participantes,
+                                 ListaInscricoes* inscricoes, LogOperacoes* log, int* proximoIdEvento,
+                                 int* proximoIdParticipante, MotorInscricoes* motor, FilaAceitas* fila, int* id,
+                                 int* espera) {
+    const char* comando = leitor->campos[0];
     
-    Evento* atual = lista_eventos;
-    while (atual != NULL) {
-        if (atual->vagasDisponiveis > 0) {
-            printf("ID: %d\n", atual->id);
-            printf("Nome: %s\n", atual->nome);
-            printf("Categoria: %s\n", atual->categoria);
-            printf("Data: %s\n", atual->data);
-            printf("Vagas disponíveis: %d\n", atual->vagasDisponiveis);
-            printf("--------------------\n");
-            encontrado = true;
+    if (strcmp(comando, "evento") == 0) {
+        // evento,nome,descricao,categoria,data,capacidade (limites de texto da entrada interativa)
+        uint32_t data;
+        int capacidade;
+        if (!csv_verificar_campos(leitor, 6) || !csv_campo_texto(leitor, 1, 100) ||
+            !csv_campo_texto(leitor, 2, 500) || !csv_campo_texto(leitor, 3, 50) ||
+            !csv_campo_data(leitor, 4, &data) || !csv_campo_inteiro(leitor, 5, &capacidade)) {
+            return leitor->erro;
         }
-        atual = atual->proximo;
+        if (capacidade < 0) {
+            return "capacidade negativa";
+        }
+        int pos = eventos_adicionar(eventos, *proximoIdEvento, leitor->campos[1], leitor->campos[2],
+                                    leitor->campos[3], data, capacidade);
+        log_registrar_evento(log, OP_EVENTO_CRIAR, eventos, pos);
+        *id = (*proximoIdEvento)++;
+        return NULL;
     }
     
-    if (!encontrado) {
-        printf("Nenhum evento com vagas disponíveis.\n");
+    if (strcmp(comando, "participante") == 0) {
+        // participante,nome,email,telefone
+        if (!csv_verificar_campos(leitor, 4) ||
+            !csv_campo_texto(leitor, 1, PARTICIPANTE_NOME_TAMANHO) ||
+            !csv_campo_texto(leitor, 2, PARTICIPANTE_EMAIL_TAMANHO) ||
+            !csv_campo_texto(leitor, 3, PARTICIPANTE_TELEFONE_TAMANHO)) {
+            return leitor->erro;
+        }
+        // Repetições do email (normalizado) são recusadas, inclusive entre linhas do mesmo lote: O(1) por linha
+        if (participantes_email_em_uso(participantes, leitor->campos[2], 0) != -1) {
+            return "email já cadastrado";
+        }
+        int pos = participantes_adicionar(participantes, *proximoIdParticipante, leitor->campos[1],
+                                          leitor->campos[2], leitor->campos[3]);
+        log_registrar_participante(log, OP_PARTICIPANTE_CRIAR, participantes, pos);
+        *id = (*proximoIdParticipante)++;
+        return NULL;
     }
-}
-
-// Função para gerar relatório de participantes por evento
-void relatorio_participantes_por_evento(ListaInscricoes* lista_inscricoes) {
-    int idEvento;
     
-    printf("\n== Relatório: Participantes por Evento ==\n");
-    printf("ID do evento: ");
-    scanf("%d", &idEvento);
+    bool inscrever = strcmp(comando, "inscrever") == 0;
+    if (inscrever || strcmp(comando, "cancelar") == 0) {
+        // inscrever|cancelar,idParticipante,idEvento (mesma ordem de inscricoes.csv)
+        int idParticipante, idEvento;
+        if (!csv_verificar_campos(leitor, 3) || !csv_campo_inteiro(leitor, 1, &idParticipante) ||
+            !csv_campo_inteiro(leitor, 2, &idEvento)) {
+            return leitor->erro;
+        }
+        if (inscrever) {
+            // O motor faz as verificações de inscricao_impedimento, na mesma ordem, e ocupa a vaga
+            const char* motivo;
+            if (motor_inscrever_agora(motor, fila, idParticipante, idEvento, log, &motivo) == NULL) {
+                if (motivo != MOTIVO_SEM_VAGAS) {
+                    return motivo;
+                }
+                // Evento lotado: como no menu, a inscrição vai para a lista de espera (o motor recusa a
+                // falta de vaga antes de conferir o participante, então as verificações são refeitas)
+                int evento = eventos_buscar_por_id(eventos, idEvento);
+                int participante = participantes_buscar_por_id(participantes, idParticipante);
+                motivo = inscricao_impedimento(eventos, participantes, inscricoes, evento, participante, true);
+                if (motivo != NULL) {
+                    return motivo;
+                }
+                Inscricao* nova = lista_inscricoes_inscrever(inscricoes, eventos, participantes, participante,
+                                                             evento, motor->data);
+                log_registrar_inscricao(log, eventos, participantes, nova);
+                *espera = lista_espera_posicao(eventos, nova);
+            }
+        } else {
+            if (!lista_inscricoes_cancelar(inscricoes, eventos, participantes, idParticipante, idEvento)) {
+                return "inscrição não encontrada ou já cancelada";
+            }
+            log_registrar_ids(log, OP_INSCRICAO_CANCELAR, idParticipante, idEvento);
+        }
+        *id = idEvento;
+        return NULL;
+    }
     
-    lista_inscricoes_por_evento(lista_inscricoes, idEvento);
+    return "comando desconhecido (use evento, participante, inscrever ou cancelar)";
 }
 
-// Função para gerar estatísticas do sistema
-void relatorio_estatisticas(Evento* lista_eventos, ListaParticipantes* lista_participantes, 
-                           ListaInscricoes* lista_inscricoes) {
-    int total_eventos = contar_eventos(lista_eventos);
+// Função para processar um arquivo de comandos ("-" é a entrada padrão) sem menus nem listagens:
+// cada comando é validado como na entrada interativa e registrado no log, e o resultado sai em uma
+// linha CSV por comando na saída padrão ("linha,ok,id", "linha,espera,posição" ou "linha,erro,motivo")
+bool processar_lote(const char* caminho, TabelaEventos* eventos, TabelaParticipantes* participantes,
+                    ListaInscricoes* inscricoes, LogOperacoes* log, int* proximoIdEvento,
+                    int* proximoIdParticipante) {
+    LeitorCSV leitor;
+    if (!csv_abrir(&leitor, caminho)) {
+        fprintf(stderr, "Não foi possível abrir o arquivo de comandos %s\n", caminho);
+        return false;
+    }
     
-    printf("\n== Relatório: Estatísticas do Sistema ==\n");
-    printf("Total de eventos: %d\n", total_eventos);
-    printf("Total de participantes: %d\n", lista_participantes->tamanho);
-    printf("Total de inscrições: %d\n", lista_inscricoes->tamanho);
+    // Resultados formatados pelo escritor CSV, sem printf por linha
+    EscritorCSV saida;
+    fflush(stdout);
+    csv_abrir_saida(&saida, stdout, "a saída padrão");
+    char data_atual[11];
+    obter_data_atual(data_atual);
     
-    // Calcular média de inscrições por evento
-    if (total_eventos > 0) {
-        float media = (float)lista_inscricoes->tamanho / total_eventos;
-        printf("Média de inscrições por evento: %.2f\n", media);
-    }
+    // Uma sessão do motor para o lote inteiro: cada inscrição aceita é publicada antes do próximo comando
+    MotorInscricoes* motor = (MotorInscricoes*)alocar_memoria(sizeof(MotorInscricoes));
+    motor_iniciar(motor, eventos, participantes, inscricoes, data_atual);
+    FilaAceitas fila = { NULL, 0, 0 };
     
-    // Encontrar evento com mais inscrições
-    if (total_eventos > 0) {
-        Evento* atual = lista_eventos;
-        int max_inscricoes = 0;
-        int id_max = -1;
-        char nome_max[100] = "";
-        
-        while (atual != NULL) {
-            int inscricoes = atual->capacidade - atual->vagasDisponiveis;
-            if (inscricoes > max_inscricoes) {
-                max_inscricoes = inscricoes;
-                id_max = atual->id;
-                strcpy(nome_max, atual->nome);
-            }
-            atual = atual->proximo;
-        }
-        
-        if (id_max != -1) {
-            printf("Evento com mais inscrições: %s (ID: %d) - %d inscrições\n", 
-                   nome_max, id_max, max_inscricoes);
+    // Sem usuário esperando, o log é confirmado em grupos maiores (menos fsyncs por comando)
+    log->registros_por_grupo = LOG_GRUPO_LOTE;
+    double inicio = relogio_ms();
+    long aplicados = 0, rejeitados = 0;
+    int resultado;
+    while ((resultado = csv_proximo_registro(&leitor)) != 0) {
+        int id = 0, espera = 0;
+        const char* motivo = resultado < 0 ? leitor.erro
+                                           : lote_executar(&leitor, eventos, participantes, inscricoes, log,
+                                                           proximoIdEvento, proximoIdParticipante, motor, &fila, &id,
+                                                           &espera);
+        csv_escrever_inteiro(&saida, (int)leitor.linha);
+        if (motivo == NULL && espera > 0) {
+            csv_escrever_simples(&saida, "espera");
+            csv_escrever_inteiro(&saida, espera);
+            aplicados++;
+        } else if (motivo == NULL) {
+            csv_escrever_simples(&saida, "ok");
+            csv_escrever_inteiro(&saida, id);
+            aplicados++;
+        } else {
+            csv_escrever_simples(&saida, "erro");
+            csv_escrever_texto(&saida, motivo);
+            rejeitados++;
         }
+        csv_terminar_registro(&saida);
     }
+    csv_fechar(&leitor);
+    liberar_memoria(fila.itens);
+    motor_liberar(motor);
+    liberar_memoria(motor);
+    log_confirmar(log);
+    log->registros_por_grupo = LOG_GRUPO_REGISTROS;
+    bool ok = csv_concluir_saida(&saida);
+    
+    fprintf(stderr, "%ld comandos aplicados e %ld rejeitados em %.0f ms\n",
+            aplicados, rejeitados, relogio_ms() - inicio);
+    return ok;
 }
 
-// ====== FUNÇÕES DE PERSISTÊNCIA EM CSV ======
+// ====== IMPORTAÇÃO EM MASSA DE INSCRIÇÕES ======
 
-// Salvar eventos em CSV
-void salvar_eventos_csv(Evento* lista, const char* filename) {
-    FILE* f = fopen(filename, "w");
-    if (!f) return;
-    Evento* atual = lista;
-    fprintf(f, "id,nome,descricao,categoria,data,capacidade,vagasDisponiveis\n");
-    while (atual) {
-        fprintf(f, "%d,\"%s\",\"%s\",\"%s\",%s,%d,%d\n",
-            atual->id, atual->nome, atual->descricao, atual->categoria,
-            atual->data, atual->capacidade, atual->vagasDisponiveis);
-        atual = atual->proximo;
-    }
-    fclose(f);
-}
+// Resultado de cada linha importada (as verificações de inscricao_impedimento, feitas em bloco)
+typedef enum {
+    IMPORTACAO_ACEITA,
+    IMPORTACAO_EVENTO_INEXISTENTE,
+    IMPORTACAO_SEM_VAGAS,
+    IMPORTACAO_PARTICIPANTE_INEXISTENTE,
+    IMPORTACAO_JA_INSCRITO,
+    IMPORTACAO_REPETIDA,
+    IMPORTACAO_MAL_FORMADA       // Registro com erro de formato (mensagem do leitor CSV)
+} ResultadoImportacao;
 
-// Carregar eventos de CSV
-Evento* carregar_eventos_csv(const char* filename, int* proximoIdEvento) {
-    FILE* f = fopen(filename, "r");
-    if (!f) return NULL;
-    Evento* lista = NULL;
-    char linha[1024];
-    fgets(linha, sizeof(linha), f); // header
-    int id, capacidade, vagas;
-    char nome[100], descricao[500], categoria[50], data[11];
-    while (fgets(linha, sizeof(linha), f)) {
-        sscanf(linha, "%d,\"%99[^\"]\",\"%499[^\"]\",\"%49[^\"]\",%10[^,],%d,%d",
-            &id, nome, descricao, categoria, data, &capacidade, &vagas);
-        Evento* novo = evento_criar(id, nome, descricao, categoria, data, capacidade);
-        novo->vagasDisponiveis = vagas;
-        lista = eventos_adicionar(lista, novo);
-        if (id >= *proximoIdEvento) *proximoIdEvento = id + 1;
+static const char* const motivos_importacao[] = {
+    "",
+    MOTIVO_EVENTO_INEXISTENTE,
+    MOTIVO_SEM_VAGAS,
+    MOTIVO_PARTICIPANTE_INEXISTENTE,
+    MOTIVO_JA_INSCRITO,
+    "inscrição repetida no arquivo"
+};
+
+// Linhas do arquivo de importação em vetores paralelos, na ordem do arquivo
+typedef struct importacao {
+    int* participantes;          // ID do participante de cada linha
+    int* eventos;                // ID do evento
+    uint32_t* datas;             // Data da inscrição (compactada)
+    int* linhas;                 // Linha no arquivo
+    uint8_t* resultados;         // ResultadoImportacao
+    int quantidade;
+    int alocadas;
+    char (*mensagens)[128];      // Mensagens dos registros mal formados, na ordem do arquivo
+    int quantidade_mensagens;
+    int alocadas_mensagens;
+} Importacao;
+
+// Função para acrescentar uma linha à importação
+static void importacao_acrescentar(Importacao* imp, int idParticipante, int idEvento, uint32_t data, int linha,
+                                   ResultadoImportacao resultado) {
+    if (imp->quantidade == imp->alocadas) {
+        imp->alocadas = imp->alocadas == 0 ? 4096 : imp->alocadas * 2;
+        imp->participantes = (int*)coluna_redimensionar(imp->participantes, imp->alocadas, sizeof(int));
+        imp->eventos = (int*)coluna_redimensionar(imp->eventos, imp->alocadas, sizeof(int));
+        imp->datas = (uint32_t*)coluna_redimensionar(imp->datas, imp->alocadas, sizeof(uint32_t));
+        imp->linhas = (int*)coluna_redimensionar(imp->linhas, imp->alocadas, sizeof(int));
+        imp->resultados = (uint8_t*)coluna_redimensionar(imp->resultados, imp->alocadas, sizeof(uint8_t));
     }
-    fclose(f);
-    return lista;
+    int k = imp->quantidade++;
+    imp->participantes[k] = idParticipante;
+    imp->eventos[k] = idEvento;
+    imp->datas[k] = data;
+    imp->linhas[k] = linha;
+    imp->resultados[k] = (uint8_t)resultado;
 }
 
-// Salvar participantes em CSV
-void salvar_participantes_csv(ListaParticipantes* lista, const char* filename) {
-    FILE* f = fopen(filename, "w");
-    if (!f) return;
-    Participante* atual = lista->inicio;
-    fprintf(f, "id,nome,email,telefone\n");
-    if (atual) {
-        int first = 1;
-        do {
-            if (!first && atual == lista->inicio) break;
-            fprintf(f, "%d,\"%s\",\"%s\",\"%s\"\n",
-                atual->id, atual->nome, atual->email, atual->telefone);
-            atual = atual->proximo;
-            first = 0;
-        } while (atual != lista->inicio);
+// Função para guardar a mensagem de um registro mal formado (que entra como linha rejeitada)
+static void importacao_registrar_erro(Importacao* imp, const LeitorCSV* leitor) {
+    if (imp->quantidade_mensagens == imp->alocadas_mensagens) {
+        imp->alocadas_mensagens = imp->alocadas_mensagens == 0 ? 16 : imp->alocadas_mensagens * 2;
+        imp->mensagens = (char (*)[128])coluna_redimensionar(imp->mensagens, imp->alocadas_mensagens,
+                                                             sizeof(imp->mensagens[0]));
     }
-    fclose(f);
+    snprintf(imp->mensagens[imp->quantidade_mensagens++], sizeof(imp->mensagens[0]), "%s", leitor->erro);
+    importacao_acrescentar(imp, 0, 0, 0, (int)leitor->linha, IMPORTACAO_MAL_FORMADA);
 }
 
-// Carregar participantes de CSV
-void carregar_participantes_csv(ListaParticipantes* lista, const char* filename, int* proximoIdParticipante) {
-    FILE* f = fopen(filename, "r");
-    if (!f) return;
-    char linha[512];
-    fgets(linha, sizeof(linha), f); // header
-    int id;
-    char nome[100], email[100], telefone[20];
-    while (fgets(linha, sizeof(linha), f)) {
-        sscanf(linha, "%d,\"%99[^\"]\",\"%99[^\"]\",\"%19[^\"]\"",
-            &id, nome, email, telefone);
-        Participante* novo = participante_criar(id, nome, email, telefone);
-        lista_participantes_adicionar(lista, novo);
-        if (id >= *proximoIdParticipante) *proximoIdParticipante = id + 1;
-    }
-    fclose(f);
+// Função para liberar as linhas da importação
+static void importacao_liberar(Importacao* imp) {
+    liberar_memoria(imp->participantes);
+    liberar_memoria(imp->eventos);
+    liberar_memoria(imp->datas);
+    liberar_memoria(imp->linhas);
+    liberar_memoria(imp->resultados);
+    liberar_memoria(imp->mensagens);
 }
 
-// Salvar inscrições em CSV
-void salvar_inscricoes_csv(ListaInscricoes* lista, const char* filename) {
-    FILE* f = fopen(filename, "w");
-    if (!f) return;
-    fprintf(f, "idParticipante,idEvento,dataInscricao,status\n");
-    Inscricao* atual = lista->inicio;
-    while (atual) {
-        fprintf(f, "%d,%d,%s,%d\n",
-            atual->participante->id, atual->evento->id,
-            atual->dataInscricao, atual->status);
-        atual = atual->proxima;
+// Função para montar o caminho do arquivo de rejeitadas ("novas.csv" -> "novas_rejeitadas.csv")
+static char* importacao_caminho_rejeitadas(const char* caminho) {
+    size_t comprimento = strlen(caminho);
+    if (comprimento >= 4 && strcmp(caminho + comprimento - 4, ".csv") == 0) {
+        comprimento -= 4;
     }
-    fclose(f);
+    char* destino = (char*)alocar_memoria(comprimento + sizeof("_rejeitadas.csv"));
+    memcpy(destino, caminho, comprimento);
+    strcpy(destino + comprimento, "_rejeitadas.csv");
+    return destino;
 }
 
-// Carregar inscrições de CSV
-void carregar_inscricoes_csv(ListaInscricoes* lista, Evento* lista_eventos, ListaParticipantes* lista_participantes, const char* filename) {
-    FILE* f = fopen(filename, "r");
-    if (!f) return;
-    char linha[256];
-    fgets(linha, sizeof(linha), f); // header
-    int idParticipante, idEvento, status;
-    char dataInscricao[11];
-    while (fgets(linha, sizeof(linha), f)) {
-        sscanf(linha, "%d,%d,%10[^,],%d", &idParticipante, &idEvento, dataInscricao, &status);
-        Participante* p = lista_participantes_buscar_por_id(lista_participantes, idParticipante);
-        Evento* e = eventos_buscar_por_id(lista_eventos, idEvento);
-        if (p && e) {
-            Inscricao* nova = inscricao_criar(p, e, dataInscricao, (StatusInscricao)status);
-            lista_inscricoes_adicionar(lista, nova);
+// Função para importar um arquivo grande de inscrições (idParticipante,idEvento[,dataInscricao], com
+// cabeçalho). Em vez de duas buscas por linha, as linhas são ordenadas por participante e por
+// (evento, participante) e juntadas em uma passada com participantes e eventos também ordenados
+// por ID; as vagas são conferidas em bloco, na ordem do arquivo, e as linhas rejeitadas vão para
+// um CSV com a linha e o motivo. As inscrições aceitas não passam pelo log: o checkpoint seguinte
+// as grava em um segmento
+bool importar_inscricoes(const char* caminho, TabelaEventos* eventos, TabelaParticipantes* participantes,
+                         ListaInscricoes* inscricoes) {
+    double inicio = relogio_ms();
+    LeitorCSV leitor;
+    if (!csv_abrir(&leitor, caminho)) {
+        fprintf(stderr, "Não foi possível abrir o arquivo de importação %s\n", caminho);
+        return false;
+    }
+    char hoje[11];
+    obter_data_atual(hoje);
+    uint32_t data_hoje = data_compactar(hoje);
+    
+    // 1. Leitura: só conversão e validação de formato
+    Importacao imp;
+    memset(&imp, 0, sizeof(imp));
+    csv_proximo_registro(&leitor); // header
+    int resultado;
+    while ((resultado = csv_proximo_registro(&leitor)) != 0) {
+        int idParticipante, idEvento;
+        uint32_t data = data_hoje;
+        if (resultado < 0 ||
+            (leitor.quantidade != 2 && !csv_verificar_campos(&leitor, 3)) ||
+            !csv_campo_inteiro(&leitor, 0, &idParticipante) || !csv_campo_inteiro(&leitor, 1, &idEvento) ||
+            (leitor.quantidade == 3 && !csv_campo_data(&leitor, 2, &data))) {
+            importacao_registrar_erro(&imp, &leitor);
+            continue;
         }
+        importacao_acrescentar(&imp, idParticipante, idEvento, data, (int)leitor.linha, IMPORTACAO_ACEITA);
     }
-    fclose(f);
+    csv_fechar(&leitor);
+    int n = imp.quantidade;
+    double lidas = relogio_ms();
+    
+    size_t linhas_alocadas = (size_t)(n > 0 ? n : 1);
+    ChaveOrdenacao* por_participante = (ChaveOrdenacao*)alocar_memoria(linhas_alocadas * sizeof(ChaveOrdenacao));
+    ChaveOrdenacao* por_evento = (ChaveOrdenacao*)alocar_memoria(linhas_alocadas * sizeof(ChaveOrdenacao));
+    ChaveOrdenacao* auxiliar = (ChaveOrdenacao*)alocar_memoria(linhas_alocadas * sizeof(ChaveOrdenacao));
+    int* resolvidos = (int*)alocar_memoria(linhas_alocadas * sizeof(int));
+    int* posicoes = (int*)alocar_memoria(linhas_alocadas * sizeof(int));
+    
+    // 2. Junção com os participantes: linhas e participantes ordenados por ID, percorridos juntos
+    int total_participantes = participantes->tamanho;
+    ChaveOrdenacao* chaves = (ChaveOrdenacao*)alocar_memoria((size_t)(total_participantes + 1) * sizeof(ChaveOrdenacao));
+    int m = 0;
+    for (int pos = 0; pos < participantes->usados && m < total_participantes; pos++) {
+        if (participantes->registros[pos].ativo) {
+            chaves[m].chave = (uint32_t)participantes->registros[pos].id;
+            chaves[m].pos = pos;
+            m++;
+        }
+    }
+    radix_sort_chaves(chaves, auxiliar, m);
+    int validas = 0;
+    for (int k = 0; k < n; k++) {
+        resolvidos[k] = -1;
+        posicoes[k] = -1;
+        if (imp.resultados[k] == IMPORTACAO_ACEITA) {
+            por_participante[validas].chave = (uint32_t)imp.participantes[k];
+            por_participante[validas].pos = k;
+            validas++;
+        }
+    }
+    radix_sort_chaves(por_participante, auxiliar, validas);
+    for (int k = 0, j = 0; k < validas; k++) {
+        while (j < m && chaves[j].chave < por_participante[k].chave) {
+            j++;
+        }
+        if (j < m && chaves[j].chave == por_participante[k].chave) {
+            resolvidos[por_participante[k].pos] = chaves[j].pos;
+        }
+    }
+    liberar_memoria(chaves);
+    
+    // 3. Junção com os eventos, ordenando as linhas por (evento, participante): repetições no
+    // arquivo ficam vizinhas (a primeira, na ordem do arquivo, vem antes, pois a ordenação é estável)
+    int total_eventos = eventos->tamanho;
+    chaves = (ChaveOrdenacao*)alocar_memoria((size_t)(total_eventos + 1) * sizeof(ChaveOrdenacao));
+    m = 0;
+    for (int pos = eventos->inicio; pos != -1 && m < total_eventos; pos = eventos->proximo[pos]) {
+        chaves[m].chave = (uint32_t)eventos->id[pos];
+        chaves[m].pos = pos;
+        m++;
+    }
+    radix_sort_chaves(chaves, auxiliar, m);
+    for (int k = 0, v = 0; k < n; k++) {
+        if (imp.resultados[k] == IMPORTACAO_ACEITA) {
+            por_evento[v].chave = (uint64_t)(uint32_t)imp.eventos[k] << 32 | (uint32_t)imp.participantes[k];
+            por_evento[v].pos = k;
+            v++;
+        }
+    }
+    radix_sort_chaves(por_evento, auxiliar, validas);
+    for (int k = 0, j = 0; k < validas; k++) {
+        // Os IDs saem da própria chave, sem voltar às colunas da linha
+        int linha = por_evento[k].pos;
+        uint64_t evento = por_evento[k].chave >> 32;
+        while (j < m && chaves[j].chave < evento) {
+            j++;
+        }
+        if (j == m || chaves[j].chave != evento) {
+            continue;
+        }
+        posicoes[linha] = chaves[j].pos;
+        if (k > 0 && por_evento[k - 1].chave == por_evento[k].chave) {
+            imp.resultados[linha] = IMPORTACAO_REPETIDA;
+        } else if (inscricoes->ativas > 0 &&
+                   inscricao_existe(inscricoes, (int)(uint32_t)por_evento[k].chave, (int)evento)) {
+            imp.resultados[linha] = IMPORTACAO_JA_INSCRITO;
+        }
+    }
+    liberar_memoria(chaves);
+    liberar_memoria(auxiliar);
+    liberar_memoria(por_evento);
+    double juntadas = relogio_ms();
+    
+    // 4. Vagas em bloco, na ordem do arquivo, com as mesmas prioridades de inscricao_impedimento
+    int* restantes = (int*)alocar_memoria((size_t)(eventos->usados + 1) * sizeof(int));
+    memcpy(restantes, eventos->vagasDisponiveis, (size_t)eventos->usados * sizeof(int));
+    int aceitas = 0;
+    for (int k = 0; k < n; k++) {
+        if (imp.resultados[k] == IMPORTACAO_MAL_FORMADA) {
+            continue;
+        }
+        int pos = posicoes[k];
+        ResultadoImportacao r;
+        if (pos == -1) {
+            r = IMPORTACAO_EVENTO_INEXISTENTE;
+        } else if (restantes[pos] <= 0) {
+            r = IMPORTACAO_SEM_VAGAS;
+        } else if (resolvidos[k] == -1) {
+            r = IMPORTACAO_PARTICIPANTE_INEXISTENTE;
+        } else {
+            r = (ResultadoImportacao)imp.resultados[k];
+        }
+        if (r == IMPORTACAO_ACEITA) {
+            restantes[pos]--;
+            aceitas++;
+        }
+        imp.resultados[k] = (uint8_t)r;
+    }
+    for (int pos = eventos->inicio; pos != -1; pos = eventos->proximo[pos]) {
+        if (restantes[pos] != eventos->vagasDisponiveis[pos]) {
+            eventos_ajustar_vagas(eventos, pos, restantes[pos] - eventos->vagasDisponiveis[pos]);
+            conjunto_ids_adicionar(&eventos->alterados, eventos->id[pos]);
+        }
+    }
+    liberar_memoria(restantes);
+    
+    // 5. Inserção das aceitas na ordem do arquivo (lista global, listas dos eventos e índice) e
+    // gravação das rejeitadas; as listas dos participantes são encadeadas depois, na ordem de
+    // participante, percorrendo cada participante uma única vez
+    indice_reservar(&inscricoes->indice, (size_t)inscricoes->ativas + (size_t)aceitas);
+    Inscricao** criadas = (Inscricao**)alocar_memoria(linhas_alocadas * sizeof(Inscricao*));
+    char* caminho_rejeitadas = importacao_caminho_rejeitadas(caminho);
+    EscritorCSV escritor;
+    bool gravar = csv_criar(&escritor, caminho_rejeitadas);
+    if (gravar) {
+        static const char cabecalho[] = "linha,idParticipante,idEvento,motivo\n";
+        csv_escrever_bruto(&escritor, cabecalho, sizeof(cabecalho) - 1);
+    }
+    int rejeitadas = 0, mensagem = 0;
+    for (int k = 0; k < n; k++) {
+        ResultadoImportacao r = (ResultadoImportacao)imp.resultados[k];
+        if (r == IMPORTACAO_ACEITA) {
+            char data[11];
+            data_formatar(imp.datas[k], data);
+            Inscricao* nova = inscricao_criar(resolvidos[k], posicoes[k], data, CONFIRMADA);
+            lista_inscricoes_encadear(inscricoes, eventos, nova);
+            indice_inserir(&inscricoes->indice, indice_chave_inscricao(imp.participantes[k], imp.eventos[k]), nova);
+            inscricoes->ativas++;
+            criadas[k] = nova;
+            continue;
+        }
+        criadas[k] = NULL;
+        rejeitadas++;
+        if (gravar) {
+            csv_escrever_inteiro(&escritor, imp.linhas[k]);
+            if (r == IMPORTACAO_MAL_FORMADA) {
+                csv_escrever_simples(&escritor, "");
+                csv_escrever_simples(&escritor, "");
+                csv_escrever_texto(&escritor, imp.mensagens[mensagem++]);
+            } else {
+                csv_escrever_inteiro(&escritor, imp.participantes[k]);
+                csv_escrever_inteiro(&escritor, imp.eventos[k]);
+                csv_escrever_texto(&escritor, motivos_importacao[r]);
+            }
+            csv_terminar_registro(&escritor);
+        }
+    }
+    if (gravar) {
+        csv_concluir(&escritor);
+    }
+    for (int k = 0; k < validas; k++) {
+        Inscricao* nova = criadas[por_participante[k].pos];
+        if (nova != NULL) {
+            inscricao_encadear_no_participante(participantes, nova);
+        }
+    }
+    liberar_memoria(por_participante);
+    liberar_memoria(criadas);
+    
+    printf("%d linhas: %d inscrições importadas e %d rejeitadas (%s)\n", n, aceitas, rejeitadas, caminho_rejeitadas);
+    fprintf(stderr, "Leitura %.0f ms, junção %.0f ms, inserção %.0f ms\n",
+            lidas - inicio, juntadas - lidas, relogio_ms() - juntadas);
+    liberar_memoria(caminho_rejeitadas);
+    liberar_memoria(posicoes);
+    liberar_memoria(resolvidos);
+    importacao_liberar(&imp);
+    return true;
 }
 
 // ====== FUNÇÃO PRINCIPAL ======
 
-int main() {
+int main(int argc, char* argv[]) {
     // Troque para o locale UTF-8 do Windows se disponível
     setlocale(LC_ALL, ".UTF8");
+    PoliticaSincronizacao politica = LOG_SINCRONIZAR_EM_GRUPO;
+    const char* arquivo_lote = NULL;
+    const char* arquivo_importacao = NULL;
+    for (int a = 1; a < argc; a++) {
+        if (strncmp(argv[a], "--lote=", 7) == 0) {
+            arquivo_lote = argv[a] + 7;
+        } else if (strncmp(argv[a], "--importar-inscricoes=", 22) == 0) {
+            arquivo_importacao = argv[a] + 22;
+        } else if (strncmp(argv[a], "--estresse-inscricoes", 21) == 0) {
+            int maximo = argv[a][21] == '=' ? atoi(argv[a] + 22) : 64;
+            return estresse_inscricoes(maximo > 0 ? maximo : 64) ? EXIT_SUCCESS : EXIT_FAILURE;
+        } else if (strncmp(argv[a], "--tarefas=", 10) == 0) {
+            tarefas_configuradas = atoi(argv[a] + 10);
+            if (tarefas_configuradas < 1) {
+                fprintf(stderr, "Quantidade de tarefas inválida: %s\n", argv[a] + 10);
+                return EXIT_FAILURE;
+            }
+        } else if (strncmp(argv[a], "--limite-canceladas=", 20) == 0) {
+            limite_canceladas = atoi(argv[a] + 20);
+            if (limite_canceladas < 0 || limite_canceladas > 100) {
+                fprintf(stderr, "Limite de canceladas inválido: %s (use uma porcentagem de 0 a 100)\n", argv[a] + 20);
+                return EXIT_FAILURE;
+            }
+        } else if (strncmp(argv[a], "--sincronizar=", 14) == 0) {
+            if (!politica_de_texto(argv[a] + 14, &politica)) {
+                fprintf(stderr, "Política de sincronização inválida: %s (use sempre, grupo ou nunca)\n", argv[a] + 14);
+                return EXIT_FAILURE;
+            }
+        } else {
+            return converter_arquivos(argv[a]);
+        }
+    }
     // Inicialização de estruturas
-    Evento* lista_eventos = NULL;
-    ListaParticipantes* lista_participantes = lista_participantes_criar();
+    TabelaEventos* lista_eventos = tabela_eventos_criar();
+    TabelaParticipantes* lista_participantes = tabela_participantes_criar();
     ListaInscricoes* lista_inscricoes = lista_inscricoes_criar();
 
     // Contadores para IDs
     int proximoIdEvento = 1;
     int proximoIdParticipante = 1;
 
-    // Carregar dados dos arquivos CSV
-    lista_eventos = carregar_eventos_csv("eventos.csv", &proximoIdEvento);
-    carregar_participantes_csv(lista_participantes, "participantes.csv", &proximoIdParticipante);
-    carregar_inscricoes_csv(lista_inscricoes, lista_eventos, lista_participantes, "inscricoes.csv");
+    // Carregar dados: snapshot binário, segmentos e operações do log, se houver segmentos ou
+    // operações pendentes ou se o snapshot estiver em dia com os CSVs; senão, arquivos CSV seguidos
+    // de uma compactação (segmentos e log só podem ser aplicados sobre um snapshot)
+    static const char* const arquivos_csv[] = { "eventos.csv", "participantes.csv", "inscricoes.csv" };
+    LogOperacoes log;
+    log_abrir(&log, ARQUIVO_LOG, politica);
+    Segmentos segmentos;
+    segmentos_contar(&segmentos);
+    bool pendente = log_pendente(&log) || segmentos.quantidade > 0;
+    bool csv_editados = !snapshot_atualizado(ARQUIVO_SNAPSHOT, arquivos_csv, 3);
+    uint64_t lsn;
+    if ((pendente || !csv_editados) &&
+        carregar_snapshot(lista_eventos, lista_participantes, lista_inscricoes, ARQUIVO_SNAPSHOT,
+                          &proximoIdEvento, &proximoIdParticipante, &lsn)) {
+        if (csv_editados) {
+            fprintf(stderr, "Os CSVs foram alterados depois do snapshot, mas há alterações mais recentes "
+                            "em segmentos ou no log: os CSVs foram ignorados\n");
+        }
+        lsn = segmentos_aplicar(&segmentos, lsn, lista_eventos, lista_participantes, lista_inscricoes,
+                                &proximoIdEvento, &proximoIdParticipante);
+        alteracoes_limpar(lista_eventos, lista_participantes, lista_inscricoes);
+        int recuperadas = log_reaplicar(&log, lsn, lista_eventos, lista_participantes, lista_inscricoes,
+                                        &proximoIdEvento, &proximoIdParticipante);
+        if (recuperadas > 0) {
+            printf("Recuperadas %d operações de %s.\n", recuperadas, ARQUIVO_LOG);
+        }
+    } else {
+        if (log_pendente(&log)) {
+            fprintf(stderr, "Sem snapshot válido: as operações de %s não podem ser reaplicadas\n", ARQUIVO_LOG);
+            log_preservar(&log, ".ignorado");
+        }
+        if (segmentos.quantidade > 0) {
+            fprintf(stderr, "Sem snapshot válido: %d segmentos de alterações foram descartados\n",
+                    segmentos.quantidade);
+        }
+        carregar_arquivos_csv(lista_eventos, lista_participantes, lista_inscricoes, &proximoIdEvento,
+                              &proximoIdParticipante);
+        compactar(&log, &segmentos, lista_eventos, lista_participantes, lista_inscricoes, false);
+    }
 
-    int opcao, subOpcao;
+    // No modo em lote e na importação os dados vêm do arquivo e nenhum menu é exibido
+    bool sucesso = true;
+    if (arquivo_lote != NULL) {
+        sucesso = processar_lote(arquivo_lote, lista_eventos, lista_participantes, lista_inscricoes, &log,
+                                 &proximoIdEvento, &proximoIdParticipante);
+    } else if (arquivo_importacao != NULL) {
+        sucesso = importar_inscricoes(arquivo_importacao, lista_eventos, lista_participantes, lista_inscricoes);
+    } else {
+        int opcao, subOpcao;
     
-    do {
-        exibir_menu_principal();
-        scanf("%d", &opcao);
+        do {
+            exibir_menu_principal();
+            scanf("%d", &opcao);
         
-        switch (opcao) {
-            case 1: // Menu de Eventos
-                do {
-                    exibir_menu_eventos();
-                    scanf("%d", &subOpcao);
+            switch (opcao) {
+                case 1: // Menu de Eventos
+                    do {
+                        // Fecha o grupo de operações do log antes de esperar pelo usuário
+                        log_confirmar(&log);
+                        exibir_menu_eventos();
+                        scanf("%d", &subOpcao);
                     
-                    switch (subOpcao) {
-                        case 1:
-                            adicionar_evento(&lista_eventos, &proximoIdEvento);
-                            break;
-                        case 2:
-                            eventos_listar(lista_eventos);
-                            break;
-                        case 3:
-                            buscar_evento(lista_eventos);
-                            break;
-                        case 4:
-                            editar_evento(lista_eventos);
-                            break;
-                        case 5:
-                            remover_evento(&lista_eventos);
-                            break;
-                        case 6:
-                            {
-                                int totalEventos = contar_eventos(lista_eventos);
-                                if (totalEventos > 0) {
-                                    ordenar_eventos_por_data(lista_eventos, totalEventos);
-                                    printf("\nEventos ordenados por data!\n");
-                                    eventos_listar(lista_eventos);
-                                } else {
-                                    printf("\nNenhum evento para ordenar.\n");
+                        switch (subOpcao) {
+                            case 1:
+                                adicionar_evento(lista_eventos, &proximoIdEvento, &log);
+                                break;
+                            case 2:
+                                eventos_listar(lista_eventos);
+                                break;
+                            case 3:
+                                buscar_evento(lista_eventos);
+                                break;
+                            case 4:
+                                editar_evento(lista_eventos, lista_participantes, lista_inscricoes, &log);
+                                break;
+                            case 5:
+                                remover_evento(lista_eventos, lista_participantes, lista_inscricoes, &log);
+                                break;
+                            case 6:
+                                {
+                                    int totalEventos = contar_eventos(lista_eventos);
+                                    if (totalEventos > 0) {
+                                        ordenar_eventos_por_data(lista_eventos, totalEventos);
+                                        printf("\nEventos ordenados por data!\n");
+                                        eventos_listar(lista_eventos);
+                                    } else {
+                                        printf("\nNenhum evento para ordenar.\n");
+                                    }
                                 }
-                            }
-                            break;
-                        case 0:
-                            break;
-                        default:
-                            printf("\nOpção inválida!\n");
-                    }
-                } while (subOpcao != 0);
-                break;
+                                break;
+                            case 7:
+                                buscar_eventos_por_texto(lista_eventos);
+                                break;
+                            case 0:
+                                break;
+                            default:
+                                printf("\nOpção inválida!\n");
+                        }
+                    } while (subOpcao != 0);
+                    break;
                 
-            case 2: // Menu de Participantes
-                do {
-                    exibir_menu_participantes();
-                    scanf("%d", &subOpcao);
+                case 2: // Menu de Participantes
+                    do {
+                        log_confirmar(&log);
+                        exibir_menu_participantes();
+                        scanf("%d", &subOpcao);
                     
-                    switch (subOpcao) {
-                        case 1:
-                            adicionar_participante(lista_participantes, &proximoIdParticipante);
-                            break;
-                        case 2:
-                            lista_participantes_listar(lista_participantes);
-                            break;
-                        case 3:
-                            buscar_participante(lista_participantes);
-                            break;
-                        case 4:
-                            editar_participante(lista_participantes);
-                            break;
-                        case 5:
-                            remover_participante(lista_participantes);
-                            break;
-                        case 0:
-                            break;
-                        default:
-                            printf("\nOpção inválida!\n");
-                    }
-                } while (subOpcao != 0);
-                break;
+                        switch (subOpcao) {
+                            case 1:
+                                adicionar_participante(lista_participantes, &proximoIdParticipante, &log);
+                                break;
+                            case 2:
+                                participantes_listar(lista_participantes);
+                                break;
+                            case 3:
+                                buscar_participante(lista_participantes);
+                                break;
+                            case 4:
+                                editar_participante(lista_participantes, &log);
+                                break;
+                            case 5:
+                                remover_participante(lista_participantes, lista_eventos, lista_inscricoes, &log);
+                                break;
+                            case 6:
+                                buscar_participante_por_contato(lista_participantes, true);
+                                break;
+                            case 7:
+                                buscar_participante_por_contato(lista_participantes, false);
+                                break;
+                            case 0:
+                                break;
+                            default:
+                                printf("\nOpção inválida!\n");
+                        }
+                    } while (subOpcao != 0);
+                    break;
                 
-            case 3: // Menu de Inscrições
-                do {
-                    exibir_menu_inscricoes();
-                    scanf("%d", &subOpcao);
+                case 3: // Menu de Inscrições
+                    do {
+                        log_confirmar(&log);
+                        exibir_menu_inscricoes();
+                        scanf("%d", &subOpcao);
                     
-                    switch (subOpcao) {
-                        case 1:
-                            nova_inscricao(lista_eventos, lista_participantes, lista_inscricoes);
-                            break;
-                        case 2:
-                            {
-                                int idEvento;
-                                printf("\nInforme o ID do evento: ");
-                                scanf("%d", &idEvento);
-                                lista_inscricoes_por_evento(lista_inscricoes, idEvento);
-                            }
-                            break;
-                        case 3:
-                            {
-                                int idParticipante;
-                                printf("\nInforme o ID do participante: ");
-                                scanf("%d", &idParticipante);
-                                lista_inscricoes_por_participante(lista_inscricoes, idParticipante);
-                            }
-                            break;
-                        case 4:
-                            cancelar_inscricao(lista_inscricoes);
-                            break;
-                        case 0:
-                            break;
-                        default:
-                            printf("\nOpção inválida!\n");
-                    }
-                } while (subOpcao != 0);
-                break;
+                        switch (subOpcao) {
+                            case 1:
+                                nova_inscricao(lista_eventos, lista_participantes, lista_inscricoes, &log);
+                                break;
+                            case 2:
+                                {
+                                    int idEvento;
+                                    printf("\nInforme o ID do evento: ");
+                                    scanf("%d", &idEvento);
+                                    lista_inscricoes_por_evento(lista_eventos, lista_participantes, idEvento);
+                                }
+                                break;
+                            case 3:
+                                {
+                                    int idParticipante;
+                                    printf("\nInforme o ID do participante: ");
+                                    scanf("%d", &idParticipante);
+                                    lista_inscricoes_por_participante(lista_participantes, lista_eventos, idParticipante);
+                                }
+                                break;
+                            case 4:
+                                cancelar_inscricao(lista_eventos, lista_participantes, lista_inscricoes, &log);
+                                break;
+                            case 5:
+                                consultar_lista_espera(lista_eventos, lista_inscricoes);
+                                break;
+                            case 0:
+                                break;
+                            default:
+                                printf("\nOpção inválida!\n");
+                        }
+                    } while (subOpcao != 0);
+                    break;
                 
-            case 4: // Menu de Relatórios
-                do {
-                    exibir_menu_relatorios();
-                    scanf("%d", &subOpcao);
+                case 4: // Menu de Relatórios
+                    do {
+                        exibir_menu_relatorios();
+                        scanf("%d", &subOpcao);
                     
-                    switch (subOpcao) {
-                        case 1:
-                            relatorio_eventos_por_categoria(lista_eventos);
-                            break;
-                        case 2:
-                            relatorio_eventos_com_vagas(lista_eventos);
-                            break;
-                        case 3:
-                            relatorio_participantes_por_evento(lista_inscricoes);
-                            break;
-                        case 4:
-                            relatorio_estatisticas(lista_eventos, lista_participantes, lista_inscricoes);
-                            break;
-                        case 0:
-                            break;
-                        default:
-                            printf("\nOpção inválida!\n");
+                        switch (subOpcao) {
+                            case 1:
+                                relatorio_eventos_por_categoria(lista_eventos);
+                                break;
+                            case 2:
+                                relatorio_eventos_com_vagas(lista_eventos);
+                                break;
+                            case 3:
+                                relatorio_participantes_por_evento(lista_eventos, lista_participantes);
+                                break;
+                            case 4:
+                                relatorio_estatisticas(lista_eventos, lista_participantes, lista_inscricoes);
+                                break;
+                            case 5:
+                                relatorio_eventos_por_periodo(lista_eventos);
+                                break;
+                            case 6:
+                                relatorio_proximos_eventos(lista_eventos);
+                                break;
+                            case 7:
+                                relatorio_estatisticas_por_categoria(lista_eventos);
+                                break;
+                            case 0:
+                                break;
+                            default:
+                                printf("\nOpção inválida!\n");
+                        }
+                    } while (subOpcao != 0);
+                    break;
+                
+                case 5: // Exibir todos os dados (após limpar a tela)
+                    break;
+                
+                case 6: // Checkpoint incremental
+                    if (checkpoint(&log, &segmentos, lista_eventos, lista_participantes, lista_inscricoes)) {
+                        printf("\nAlterações salvas.\n");
                     }
-                } while (subOpcao != 0);
-                break;
+                    break;
                 
-            case 0: // Sair
-                printf("\nSaindo do sistema. Obrigado!\n");
-                break;
+                case 7: // Compactação (reescrita completa, inclusive dos CSVs, e arquivamento das canceladas)
+                    {
+                        int arquivadas = lista_inscricoes->arquivadas;
+                        if (compactar(&log, &segmentos, lista_eventos, lista_participantes, lista_inscricoes, true)) {
+                            printf("\nArquivos de dados reescritos e compactados.\n");
+                            if (lista_inscricoes->arquivadas > arquivadas) {
+                                printf("%d inscrição(ões) cancelada(s) movida(s) para %s.\n",
+                                       lista_inscricoes->arquivadas - arquivadas, ARQUIVO_CANCELADAS);
+                            }
+                        }
+                    }
+                    break;
                 
-            default:
-                printf("\nOpção inválida!\n");
-        }
+                case 0: // Sair
+                    printf("\nSaindo do sistema. Obrigado!\n");
+                    break;
+                
+                default:
+                    printf("\nOpção inválida!\n");
+            }
         
 
-        // Limpar o buffer de entrada
-        while (getchar() != '\n'); // Limpar o buffer de entrada
-        // Limpar a tela
-        system("clear || cls"); // Limpar a tela (funciona em sistemas Unix e Windows)
-        printf("\n=== VOLTANDO AO MENU PRINCIPAL ===\n");
-        // Exibir a lista de eventos após cada operação
-        printf("\n=== LISTA DE EVENTOS ===\n");
-        printf("Total de eventos: %d\n", contar_eventos(lista_eventos));
-        ordenar_eventos_por_data(lista_eventos, contar_eventos(lista_eventos));
-        eventos_listar(lista_eventos);
-        printf("\n=== LISTA DE PARTICIPANTES ===\n");
-        printf("Total de participantes: %d\n", lista_participantes->tamanho);
-        lista_participantes_listar(lista_participantes);
-        printf("\n=== LISTA DE INSCRIÇÕES ===\n");
-        printf("Total de inscrições: %d\n", lista_inscricoes->tamanho);
-        if (lista_inscricoes->tamanho > 0) {
-            Inscricao* inscricao_atual = lista_inscricoes->inicio;
-            while (inscricao_atual != NULL) {
-                printf("Participante: %s (ID: %d) - Evento: %s (ID: %d) - Status: %s\n", 
-                       inscricao_atual->participante->nome, 
-                       inscricao_atual->participante->id, 
-                       inscricao_atual->evento->nome, 
-                       inscricao_atual->evento->id, 
-                       inscricao_atual->status == CONFIRMADA ? "Confirmada" : "Cancelada");
-                inscricao_atual = inscricao_atual->proxima;
+            // Limpar o buffer de entrada
+            while (getchar() != '\n'); // Limpar o buffer de entrada
+            // Limpar a tela
+            system("clear || cls"); // Limpar a tela (funciona em sistemas Unix e Windows)
+            printf("\n=== VOLTANDO AO MENU PRINCIPAL ===\n");
+            // A visão por data e os contadores já estão atualizados: basta exibi-los
+            if (opcao == 5) {
+                exibir_todos_os_dados(lista_eventos, lista_participantes, lista_inscricoes);
+            } else {
+                exibir_resumo(lista_eventos, lista_participantes, lista_inscricoes);
             }
-        } else {
-            printf("Nenhuma inscrição registrada.\n");
-        }
-        printf("\n=== FIM DA LISTA ===\n");
-
 
-    } while (opcao != 0);
+        } while (opcao != 0);
+    }
 
-    // Salvar dados nos arquivos CSV antes de sair
-    salvar_eventos_csv(lista_eventos, "eventos.csv");
-    salvar_participantes_csv(lista_participantes, "participantes.csv");
-    salvar_inscricoes_csv(lista_inscricoes, "inscricoes.csv");
+    // Checkpoint antes de sair: só as alterações da sessão vão para um novo segmento
+    checkpoint(&log, &segmentos, lista_eventos, lista_participantes, lista_inscricoes);
+    log_fechar(&log);
 
     // Liberação de memória
-    Evento* evento_atual = lista_eventos;
-    while (evento_atual != NULL) {
-        Evento* temp = evento_atual;
-        evento_atual = evento_atual->proximo;
-        evento_destruir(temp);
-    }
-    
-    lista_participantes_destruir(lista_participantes);
+    tabela_eventos_destruir(lista_eventos);
+    tabela_participantes_destruir(lista_participantes);
     lista_inscricoes_destruir(lista_inscricoes);
     
-    return 0;
+    return sucesso ? EXIT_SUCCESS : EXIT_FAILURE;
 }
\ No newline at end of file
@@ -0,0 +1,195 @@
+// Teste de remoção de eventos e participantes com inscrições
+// Compilado com AddressSanitizer pelo alvo "make test": qualquer acesso a memória liberada depois
+// das remoções (listagens, CSVs, snapshot, arquivamento ou reuso das posições) encerra o teste
+
+// O programa é incluído inteiro; o main dele é renomeado para não conflitar com o do teste
+#define main sistema_main
+#include "../src/main.c"
+#undef main
+
+static int falhas = 0;
+
+// Função para registrar uma verificação que falhou, sem interromper o teste
+static void verificar(bool condicao, const char* descricao) {
+    if (!condicao) {
+        fprintf(stderr, "FALHOU: %s\n", descricao);
+        falhas++;
+    }
+}
+
+// Função para contar as linhas de dados de um CSV (sem o cabeçalho)
+static int contar_registros_csv(const char* filename) {
+    FILE* arquivo = fopen(filename, "r");
+    if (arquivo == NULL) {
+        return -1;
+    }
+    int linhas = 0;
+    int c;
+    while ((c = fgetc(arquivo)) != EOF) {
+        if (c == '\n') {
+            linhas++;
+        }
+    }
+    fclose(arquivo);
+    return linhas - 1;
+}
+
+// Função para verificar se algum registro de inscricoes.csv menciona um participante ou evento
+static bool inscricoes_csv_menciona(const char* filename, int idParticipante, int idEvento) {
+    FILE* arquivo = fopen(filename, "r");
+    if (arquivo == NULL) {
+        return false;
+    }
+    char linha[256];
+    bool encontrado = false;
+    fgets(linha, sizeof(linha), arquivo); // Cabeçalho
+    while (fgets(linha, sizeof(linha), arquivo) != NULL) {
+        int participante, evento;
+        if (sscanf(linha, "%d,%d", &participante, &evento) == 2 &&
+            (participante == idParticipante || evento == idEvento)) {
+            encontrado = true;
+        }
+    }
+    fclose(arquivo);
+    return encontrado;
+}
+
+int main(void) {
+    // Arquivos do teste em um diretório temporário próprio
+    char diretorio[] = "/tmp/teste_remocaoXXXXXX";
+    if (mkdtemp(diretorio) == NULL || chdir(diretorio) != 0) {
+        perror("mkdtemp");
+        return EXIT_FAILURE;
+    }
+    // As listagens vão para um arquivo: só interessa que não leiam memória liberada
+    if (freopen("listagens.txt", "w", stdout) == NULL) {
+        perror("freopen");
+        return EXIT_FAILURE;
+    }
+
+    TabelaEventos* eventos = tabela_eventos_criar();
+    TabelaParticipantes* participantes = tabela_participantes_criar();
+    ListaInscricoes* inscricoes = lista_inscricoes_criar();
+    uint32_t data = data_compactar("2030-01-01");
+
+    // Evento 1 com duas vagas e lista de espera; o evento 2 e o participante 1 serão removidos
+    int evento1 = eventos_adicionar(eventos, 1, "Show", "Palco principal", "musica", data, 2);
+    int evento2 = eventos_adicionar(eventos, 2, "Oficina", "Sala 3", "tecnologia", data, 10);
+    int evento3 = eventos_adicionar(eventos, 3, "Palestra", "Auditório", "tecnologia", data, 10);
+    int posicoes[5];
+    for (int id = 1; id <= 4; id++) {
+        char email[32];
+        snprintf(email, sizeof(email), "p%d@teste.com", id);
+        posicoes[id] = participantes_adicionar(participantes, id, "Participante", email, "1199990000");
+    }
+    for (int id = 1; id <= 3; id++) {
+        lista_inscricoes_inscrever(inscricoes, eventos, participantes, posicoes[id], evento1, "2026-10-16");
+        lista_inscricoes_inscrever(inscricoes, eventos, participantes, posicoes[id], evento2, "2026-10-16");
+    }
+    lista_inscricoes_inscrever(inscricoes, eventos, participantes, posicoes[1], evento3, "2026-10-16");
+    lista_inscricoes_inscrever(inscricoes, eventos, participantes, posicoes[4], evento3, "2026-10-16");
+    verificar(eventos->espera[evento1]->aguardando == 1, "participante 3 na lista de espera do evento 1");
+
+    // Remoções em cascata: o participante 1 devolve a vaga do evento 1 ao participante 3
+    verificar(lista_inscricoes_remover_evento(inscricoes, eventos, participantes, 2), "remover evento 2");
+    verificar(lista_inscricoes_remover_participante(inscricoes, eventos, participantes, 1, true),
+              "remover participante 1");
+    verificar(eventos_buscar_por_id(eventos, 2) == -1, "evento 2 fora do índice");
+    verificar(participantes_buscar_por_id(participantes, 1) == -1, "participante 1 fora do índice");
+    verificar(eventos->espera[evento1]->aguardando == 0, "participante 3 promovido no evento 1");
+    verificar(eventos->vagasDisponiveis[evento1] == 0, "evento 1 continua lotado");
+    verificar(eventos->vagasDisponiveis[evento3] == 9, "vaga do participante 1 devolvida no evento 3");
+    verificar(inscricoes->ativas == 3, "três inscrições ativas depois das remoções");
+
+    // Listagens percorrem as inscrições canceladas que ainda apontam para os removidos
+    eventos_listar(eventos);
+    participantes_listar(participantes);
+    for (int id = 1; id <= 3; id++) {
+        lista_inscricoes_por_evento(eventos, participantes, id);
+    }
+    for (int id = 1; id <= 4; id++) {
+        lista_inscricoes_por_participante(participantes, eventos, id);
+    }
+
+    // Antes do arquivamento as posições dos removidos não podem ser reutilizadas
+    int evento4 = eventos_adicionar(eventos, 4, "Feira", "Pavilhão", "negocios", data, 5);
+    int participante5 = participantes_adicionar(participantes, 5, "Novo", "p5@teste.com", "1188880000");
+    verificar(evento4 != evento2, "evento 4 não ocupa a posição do evento 2 antes do arquivamento");
+    verificar(participante5 != posicoes[1], "participante 5 não ocupa a posição do participante 1");
+    verificar(eventos->inscricoes_inicio[evento4] == NULL, "evento 4 sem inscrições herdadas");
+    verificar(participantes->registros[participante5].inscricoes_inicio == NULL,
+              "participante 5 sem inscrições herdadas");
+    lista_inscricoes_por_evento(eventos, participantes, 4);
+    lista_inscricoes_por_participante(participantes, eventos, 5);
+
+    // CSVs: sem os removidos e sem as inscrições que apontam para eles
+    salvar_eventos_csv(eventos, "eventos.csv");
+    salvar_participantes_csv(participantes, "participantes.csv");
+    salvar_inscricoes_csv(inscricoes, eventos, participantes, "inscricoes.csv");
+    verificar(contar_registros_csv("eventos.csv") == 3, "eventos.csv com três eventos");
+    verificar(contar_registros_csv("participantes.csv") == 4, "participantes.csv com quatro participantes");
+    verificar(contar_registros_csv("inscricoes.csv") == 3, "inscricoes.csv com as três ativas");
+    verificar(!inscricoes_csv_menciona("inscricoes.csv", 1, 2), "inscricoes.csv sem o evento 2 e o participante 1");
+
+    // Snapshot gravado e recarregado em tabelas novas
+    verificar(salvar_snapshot(eventos, participantes, inscricoes, "dados.bin", 0), "gravar snapshot");
+    TabelaEventos* eventos_recarregados = tabela_eventos_criar();
+    TabelaParticipantes* participantes_recarregados = tabela_participantes_criar();
+    ListaInscricoes* inscricoes_recarregadas = lista_inscricoes_criar();
+    int proximoIdEvento = 1, proximoIdParticipante = 1;
+    uint64_t lsn = 0;
+    verificar(carregar_snapshot(eventos_recarregados, participantes_recarregados, inscricoes_recarregadas,
+                                "dados.bin", &proximoIdEvento, &proximoIdParticipante, &lsn),
+              "recarregar snapshot");
+    verificar(eventos_recarregados->tamanho == 3, "snapshot com três eventos");
+    verificar(participantes_recarregados->tamanho == 4, "snapshot com quatro participantes");
+    verificar(inscricoes_recarregadas->tamanho == 3 && inscricoes_recarregadas->ativas == 3,
+              "snapshot com as três inscrições ativas");
+    lista_inscricoes_por_evento(eventos_recarregados, participantes_recarregados, 1);
+    lista_inscricoes_destruir(inscricoes_recarregadas);
+    tabela_eventos_destruir(eventos_recarregados);
+    tabela_participantes_destruir(participantes_recarregados);
+
+    // Arquivamento: as canceladas saem da memória e liberam as posições dos removidos
+    int canceladas = lista_inscricoes_canceladas(inscricoes);
+    verificar(arquivar_inscricoes_canceladas(inscricoes, eventos, participantes, "inscricoes_canceladas.csv") ==
+              canceladas, "arquivar todas as canceladas");
+    verificar(contar_registros_csv("inscricoes_canceladas.csv") == canceladas, "arquivo morto com as canceladas");
+    verificar(lista_inscricoes_canceladas(inscricoes) == 0, "nenhuma cancelada na memória");
+    verificar(eventos->removidos == -1, "posição do evento 2 liberada");
+    verificar(participantes->removidos == -1, "posição do participante 1 liberada");
+
+    // Depois do arquivamento as posições voltam a ser usadas, sem as inscrições antigas
+    int evento5 = eventos_adicionar(eventos, 5, "Mostra", "Galeria", "arte", data, 5);
+    int participante6 = participantes_adicionar(participantes, 6, "Outro", "p6@teste.com", "1177770000");
+    verificar(evento5 == evento2, "evento 5 reutiliza a posição do evento 2");
+    verificar(participante6 == posicoes[1], "participante 6 reutiliza a posição do participante 1");
+    verificar(eventos->inscricoes_inicio[evento5] == NULL, "evento 5 sem inscrições herdadas");
+    verificar(participantes->registros[participante6].inscricoes_inicio == NULL,
+              "participante 6 sem inscrições herdadas");
+    lista_inscricoes_inscrever(inscricoes, eventos, participantes, participante6, evento5, "2026-10-16");
+    lista_inscricoes_por_evento(eventos, participantes, 5);
+    lista_inscricoes_por_participante(participantes, eventos, 6);
+    verificar(eventos->vagasDisponiveis[evento5] == 4, "inscrição no evento 5 ocupa uma vaga");
+
+    lista_inscricoes_destruir(inscricoes);
+    tabela_eventos_destruir(eventos);
+    tabela_participantes_destruir(participantes);
+
+    // Limpeza do diretório temporário
+    static const char* const arquivos[] = { "eventos.csv", "participantes.csv", "inscricoes.csv",
+                                            "inscricoes_canceladas.csv", "dados.bin", "listagens.txt" };
+    for (size_t a = 0; a < sizeof(arquivos) / sizeof(arquivos[0]); a++) {
+        remove(arquivos[a]);
+    }
+    if (chdir("/tmp") == 0) {
+        rmdir(diretorio);
+    }
+
+    if (falhas > 0) {
+        fprintf(stderr, "teste_remocao: %d falha(s)\n", falhas);
+        return EXIT_FAILURE;
+    }
+    fprintf(stderr, "teste_remocao: OK\n");
+    return EXIT_SUCCESS;
+}